@@ -240,6 +240,179 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Starts asynchronous creation of primitives for a batch of primitive
+/// descriptors.
+///
+/// The primitives are created on a pool of library-managed worker threads.
+/// Requests for primitive descriptors that map to the same primitive cache
+/// key, both within the batch and across in-flight requests, share a single
+/// creation, so the same kernels are never generated twice concurrently.
+///
+/// The primitive descriptors are cloned and can be destroyed right after
+/// the call. The engines must stay alive until the creation completes.
+///
+/// @param futures Output array of @p n primitive futures. Each future must
+///     be destroyed with #dnnl_primitive_future_destroy().
+/// @param n Number of primitive descriptors.
+/// @param primitive_descs Array of @p n primitive descriptors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. Errors of the primitive creation are reported by
+///     #dnnl_primitive_future_get().
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_future_t *futures, int n,
+        const const_dnnl_primitive_desc_t *primitive_descs);
+
+/// Checks whether the asynchronous primitive creation has completed.
+///
+/// @param future Primitive future.
+/// @param is_ready Output value: 1 if the creation has completed and 0
+///     otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_is_ready(
+        const_dnnl_primitive_future_t future, int *is_ready);
+
+/// Waits for the asynchronous primitive creation to complete and returns
+/// the primitive.
+///
+/// @param primitive Output primitive. The primitive must be destroyed with
+///     #dnnl_primitive_destroy() independently from the future.
+/// @param future Primitive future.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, including the status of the primitive creation.
+dnnl_status_t DNNL_API dnnl_primitive_future_get(
+        dnnl_primitive_t *primitive, const_dnnl_primitive_future_t future);
+
+/// Destroys a primitive future.
+///
+/// @note The creation of the primitive is not cancelled.
+///
+/// @param future Primitive future to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_destroy(
+        dnnl_primitive_future_t future);
+
+/// Prepares a primitive for repeated execution with the same arguments.
+///
+/// The arguments are converted and validated once. Executions of the
+/// prepared primitive with #dnnl_prepared_primitive_execute() only update
+/// the data handles of the bound memory objects, which reduces the execution
+/// overhead of primitives with little work, such as matrix multiplication
+/// with a single row.
+///
+/// The prepared primitive keeps a reference to the primitive. The stream and
+/// the memory objects must stay alive while the prepared primitive is used.
+///
+/// @note Prepared execution is supported for CPU engines with in-order
+///     streams only.
+///
+/// @param prepared_primitive Output prepared primitive.
+/// @param primitive Primitive to prepare.
+/// @param stream Stream to use for the executions.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments. The requirements are the same as for
+///     #dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_prepare(
+        dnnl_prepared_primitive_t *prepared_primitive,
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream, int nargs,
+        const dnnl_exec_arg_t *args);
+
+/// Executes a prepared primitive.
+///
+/// The data handles replace the handles of the memory objects bound at
+/// preparation. The handles of dummy arguments and host-side scalar memory
+/// objects are ignored; the values of host-side scalars are updated with
+/// #dnnl_memory_set_host_scalar_value().
+///
+/// @note Executions of the same prepared primitive must not overlap. For
+///     asynchronous threadpools, the stream must be waited on before the
+///     next execution.
+///
+/// @param prepared_primitive Prepared primitive to execute.
+/// @param nhandles Number of data handles. Either 0 to execute with the
+///     current data handles of the memory objects or the number of
+///     arguments passed at preparation.
+/// @param handles Array of data handles in the order of the arguments passed
+///     at preparation.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_prepared_primitive_execute(
+        dnnl_prepared_primitive_t prepared_primitive, int nhandles,
+        void *const *handles);
+
+/// Destroys a prepared primitive.
+///
+/// @param prepared_primitive Prepared primitive to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_prepared_primitive_destroy(
+        dnnl_prepared_primitive_t prepared_primitive);
+
+/// Starts recording primitive executions on a stream.
+///
+/// While the stream is recording, primitive executions submitted to it with
+/// #dnnl_primitive_execute() are validated and appended to a command list
+/// instead of being executed. The command list is obtained with
+/// #dnnl_stream_end_recording() and executes the whole sequence in a single
+/// call.
+///
+/// @note Recording is supported for CPU engines with in-order streams only.
+///     Only primitive executions are recorded. Other submissions to a
+///     recording stream, such as executions of prepared primitives, command
+///     lists, and graph compiled partitions, fail with
+///     #dnnl_invalid_arguments.
+///
+/// @param stream Stream to record on.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_recording(dnnl_stream_t stream);
+
+/// Stops recording primitive executions on a stream and returns the
+/// recorded command list.
+///
+/// @param stream Stream that is recording.
+/// @param command_list Output command list. The stream and the memory
+///     objects passed at recording must stay alive while the command list is
+///     used.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_recording(
+        dnnl_stream_t stream, dnnl_command_list_t *command_list);
+
+/// Returns the number of primitive executions in a command list.
+///
+/// @param command_list Command list.
+/// @param length Output number of primitive executions.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_get_length(
+        const_dnnl_command_list_t command_list, int *length);
+
+/// Executes a command list on the stream it was recorded on.
+///
+/// The primitives are executed in the order of recording with the memory
+/// objects passed at recording. The data handles of the memory objects can
+/// be changed between the executions with #dnnl_memory_set_data_handle().
+///
+/// @note Executions of the same command list must not overlap.
+///
+/// @param command_list Command list to execute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_execute(
+        dnnl_command_list_t command_list);
+
+/// Destroys a command list.
+///
+/// @param command_list Command list to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_destroy(
+        dnnl_command_list_t command_list);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -3883,6 +4056,105 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Sets a directory for the persistent primitive cache.
+///
+/// When the directory is set, primitives that are not found in the primitive
+/// cache are looked up in the directory before being created. Newly created
+/// primitives are serialized to the directory, so subsequent runs of the
+/// application can skip JIT compilation. Only primitives created on engines
+/// that support cache blobs are stored in the persistent cache.
+///
+/// Entries are keyed by the primitive parameters, the implementation, the
+/// device (ISA for CPU), and the library version, so stale entries are never
+/// reused. The directory must exist and be writable. Concurrently accessing
+/// the directory from multiple threads and processes of the same user is
+/// safe. On POSIX systems, entries are loaded only if they are regular files
+/// owned by the effective user and not writable by the group or others, and
+/// the content of each entry is verified against a digest stored with it.
+///
+/// @note
+///     This setting overrides the ONEDNN_PRIMITIVE_CACHE_DIR environment
+///     variable. The persistent primitive cache is disabled by default.
+///
+/// @param dir Path to the cache directory. Passing NULL or an empty string
+///     disables the persistent primitive cache.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_dir(const char *dir);
+
+/// Returns the maximum number of threads that thread-count adaptive
+/// primitives are created for.
+///
+/// @param nthr Maximum number of threads to query. The value of 0 means that
+///     thread-count adaptive primitives are disabled.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p nthr is NULL, and #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_max_threads(int *nthr);
+
+/// Sets the maximum number of threads that thread-count adaptive primitives
+/// are created for.
+///
+/// By default, primitives are created for the maximum number of threads
+/// available at creation time, and the number of threads is a part of the
+/// primitive cache key. When the value is set, implementations that support
+/// it are created for up to @p nthr threads, split the work between the
+/// threads available at execution time, and are shared in the primitive
+/// cache between callers with any number of threads. Execution never uses
+/// more than @p nthr threads.
+///
+/// @note
+///     This setting overrides the ONEDNN_PRIMITIVE_MAX_THREADS environment
+///     variable. It only affects primitives created after the call.
+///
+/// @param nthr Maximum number of threads. Setting the value to 0 disables
+///     thread-count adaptive primitives.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p nthr value is negative, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_primitive_max_threads(int nthr);
+
+/// Returns statistics of the primitive cache grouped by primitive kind and
+/// implementation name.
+///
+/// Hits, misses, and creation time are accounted for primitives stored in
+/// the primitive cache. Counters of evicted primitives are preserved. Hits
+/// are counted after the statistics are queried or reset for the first time.
+///
+/// @param nstats On input, the number of elements in @p stats. On output,
+///     the number of returned elements, or the number of available elements
+///     if @p stats is NULL.
+/// @param stats Output array of statistics. May be NULL to query the number
+///     of elements.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p nstats is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats);
+
+/// Returns statistics of the kernel cache, which holds GPU kernels shared
+/// between primitives.
+///
+/// @param nstats On input, the number of elements in @p stats. On output,
+///     the number of returned elements, or the number of available elements
+///     if @p stats is NULL.
+/// @param stats Output array of statistics. May be NULL to query the number
+///     of elements.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p nstats is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_kernel_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats);
+
+/// Resets statistics of the primitive cache. Statistics of the kernel cache
+/// are reset with dnnl_reset_kernel_cache_stats().
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_primitive_cache_stats(void);
+
+/// Resets statistics of the kernel cache.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_kernel_cache_stats(void);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -5737,6 +5737,217 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_primitive_future_t> {
+    static dnnl_status_t destructor(dnnl_primitive_future_t p) {
+        return dnnl_primitive_future_destroy(p);
+    }
+};
+/// @endcond
+
+/// A primitive which is being created asynchronously.
+///
+/// @sa dnnl::create_primitives_async
+struct primitive_future : public handle<dnnl_primitive_future_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    primitive_future() = default;
+
+    /// Checks whether the primitive creation has completed.
+    ///
+    /// @returns @c true if the creation has completed and @c false
+    ///     otherwise.
+    bool is_ready() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_future_is_ready(get(), &result),
+                "could not query a primitive future");
+        return result != 0;
+    }
+
+    /// Waits for the primitive creation to complete and returns the
+    /// primitive. Throws if the creation has failed.
+    ///
+    /// @returns The created primitive.
+    primitive get_primitive() const {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_future_get(&result, get()),
+                "could not create a primitive");
+        return primitive(result);
+    }
+};
+
+/// Starts asynchronous creation of primitives for a batch of primitive
+/// descriptors.
+///
+/// The primitives are created on a pool of library-managed worker threads.
+/// Requests for primitive descriptors that map to the same primitive cache
+/// key share a single creation.
+///
+/// @param pds Primitive descriptors. They can be destroyed right after the
+///     call. The engines must stay alive until the creation completes.
+/// @returns Primitive futures, one per primitive descriptor.
+inline std::vector<primitive_future> create_primitives_async(
+        const std::vector<primitive_desc_base> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+
+    std::vector<dnnl_primitive_future_t> c_futures(pds.size());
+    error::wrap_c_api(dnnl_primitive_create_async(c_futures.data(),
+                              (int)c_pds.size(), c_pds.data()),
+            "could not start asynchronous primitive creation");
+
+    std::vector<primitive_future> futures;
+    futures.reserve(c_futures.size());
+    for (auto f : c_futures)
+        futures.emplace_back(f);
+    return futures;
+}
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_prepared_primitive_t> {
+    static dnnl_status_t destructor(dnnl_prepared_primitive_t p) {
+        return dnnl_prepared_primitive_destroy(p);
+    }
+};
+/// @endcond
+
+/// A primitive with arguments bound for repeated execution.
+///
+/// The arguments are converted and validated once at construction. The
+/// executions only update the data handles of the bound memory objects,
+/// which reduces the execution overhead of primitives with little work.
+///
+/// A prepared primitive constructed from a primitive keeps the primitive,
+/// the stream, and the memory objects alive.
+struct prepared_primitive : public handle<dnnl_prepared_primitive_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    prepared_primitive() = default;
+
+    /// Constructs a prepared primitive.
+    ///
+    /// @note Prepared execution is supported for CPU engines with in-order
+    ///     streams only.
+    ///
+    /// @param aprimitive Primitive to prepare.
+    /// @param astream Stream to use for the executions.
+    /// @param args Arguments. The order of the arguments defines the order
+    ///     of the data handles passed to #execute().
+    prepared_primitive(const primitive &aprimitive, const stream &astream,
+            const std::vector<std::pair<int, memory>> &args)
+        : primitive_(aprimitive), stream_(astream) {
+        std::vector<dnnl_exec_arg_t> c_args;
+        c_args.reserve(args.size());
+        args_.reserve(args.size());
+        for (const auto &a : args) {
+            c_args.push_back({a.first, a.second.get(true)});
+            args_.push_back(a.second);
+        }
+
+        dnnl_prepared_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_prepare(&result, aprimitive.get(),
+                                  astream.get(), (int)c_args.size(),
+                                  c_args.data()),
+                "could not prepare a primitive");
+        reset(result);
+    }
+
+    /// Executes the prepared primitive with the current data handles of the
+    /// bound memory objects.
+    void execute() const {
+        error::wrap_c_api(dnnl_prepared_primitive_execute(get(), 0, nullptr),
+                "could not execute a prepared primitive");
+    }
+
+    /// Executes the prepared primitive with new data handles.
+    ///
+    /// @param handles Data handles in the order of the arguments passed at
+    ///     construction. The handles of dummy arguments and host-side scalar
+    ///     memory objects are ignored.
+    void execute(const std::vector<void *> &handles) const {
+        error::wrap_c_api(dnnl_prepared_primitive_execute(get(),
+                                  (int)handles.size(), handles.data()),
+                "could not execute a prepared primitive");
+    }
+
+private:
+    // The C object refers to the memory objects and the stream without
+    // owning them.
+    primitive primitive_;
+    stream stream_;
+    std::vector<memory> args_;
+};
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_command_list_t> {
+    static dnnl_status_t destructor(dnnl_command_list_t p) {
+        return dnnl_command_list_destroy(p);
+    }
+};
+/// @endcond
+
+/// A sequence of primitive executions recorded on a stream.
+///
+/// @sa dnnl::begin_recording
+struct command_list : public handle<dnnl_command_list_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    command_list() = default;
+
+    /// Returns the number of recorded primitive executions.
+    ///
+    /// @returns The number of primitive executions.
+    int get_length() const {
+        int result;
+        error::wrap_c_api(dnnl_command_list_get_length(get(), &result),
+                "could not query a command list");
+        return result;
+    }
+
+    /// Executes the recorded primitives on the stream they were recorded on
+    /// with the current data handles of their memory objects.
+    void execute() const {
+        error::wrap_c_api(dnnl_command_list_execute(get()),
+                "could not execute a command list");
+    }
+};
+
+/// Starts recording primitive executions on a stream.
+///
+/// While the stream is recording, primitive executions submitted to it are
+/// validated and appended to a command list instead of being executed.
+/// Other submissions to the stream, such as executions of prepared
+/// primitives, command lists, and graph compiled partitions, throw.
+///
+/// @note Recording is supported for CPU engines with in-order streams only.
+///
+/// @param astream Stream to record on.
+inline void begin_recording(const stream &astream) {
+    error::wrap_c_api(dnnl_stream_begin_recording(astream.get()),
+            "could not start recording on a stream");
+}
+
+/// Stops recording primitive executions on a stream.
+///
+/// @param astream Stream that is recording. The stream and the memory
+///     objects passed at recording must stay alive while the returned command
+///     list is used.
+/// @returns The recorded command list.
+inline command_list end_recording(const stream &astream) {
+    dnnl_command_list_t result;
+    error::wrap_c_api(dnnl_stream_end_recording(astream.get(), &result),
+            "could not stop recording on a stream");
+    return command_list(result);
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -14288,6 +14499,50 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_set_primitive_cache_dir(const char *dir)
+inline void set_primitive_cache_dir(const std::string &dir) {
+    error::wrap_c_api(dnnl_set_primitive_cache_dir(dir.c_str()),
+            "could not set primitive cache directory");
+}
+
+/// @copydoc dnnl_get_primitive_max_threads(int *nthr)
+inline int get_primitive_max_threads() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_primitive_max_threads(&result),
+            "could not get primitive max threads");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_max_threads(int nthr)
+inline void set_primitive_max_threads(int nthr) {
+    error::wrap_c_api(dnnl_set_primitive_max_threads(nthr),
+            "could not set primitive max threads");
+}
+
+/// @copydoc dnnl_get_primitive_cache_stats(int *nstats, dnnl_cache_stats_t *stats)
+inline std::vector<cache_stats> get_primitive_cache_stats() {
+    return get_cache_stats(dnnl_get_primitive_cache_stats,
+            "could not get primitive cache statistics");
+}
+
+/// @copydoc dnnl_get_kernel_cache_stats(int *nstats, dnnl_cache_stats_t *stats)
+inline std::vector<cache_stats> get_kernel_cache_stats() {
+    return get_cache_stats(dnnl_get_kernel_cache_stats,
+            "could not get kernel cache statistics");
+}
+
+/// @copydoc dnnl_reset_primitive_cache_stats()
+inline void reset_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_reset_primitive_cache_stats(),
+            "could not reset primitive cache statistics");
+}
+
+/// @copydoc dnnl_reset_kernel_cache_stats()
+inline void reset_kernel_cache_stats() {
+    error::wrap_c_api(dnnl_reset_kernel_cache_stats(),
+            "could not reset kernel cache statistics");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -85,6 +85,77 @@ dnnl_status_t DNNL_API dnnl_engine_destroy(dnnl_engine_t engine);
 dnnl_status_t DNNL_API dnnl_stream_create(
         dnnl_stream_t *stream, dnnl_engine_t engine, unsigned flags);
 
+/// Creates an execution stream with attributes.
+///
+/// @param stream Output execution stream.
+/// @param engine Engine to create the execution stream on.
+/// @param flags Stream behavior flags (@sa dnnl_stream_flags_t).
+/// @param attr Stream attributes (can be NULL).
+/// @returns #dnnl_unimplemented if the attributes are not supported for the
+///     engine or the CPU runtime, #dnnl_success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_stream_create_v2(dnnl_stream_t *stream,
+        dnnl_engine_t engine, unsigned flags, const_dnnl_stream_attr_t attr);
+
+/// Creates empty stream attributes.
+///
+/// @param attr Output stream attributes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_create(dnnl_stream_attr_t *attr);
+
+/// Destroys stream attributes.
+///
+/// @param attr Stream attributes to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_destroy(dnnl_stream_attr_t attr);
+
+/// Sets the number of threads for parallel regions of primitives executed on
+/// a CPU stream. Supported for the OpenMP CPU runtime only.
+///
+/// @param attr Stream attributes.
+/// @param nthr Number of threads. The value of 0 means that the number of
+///     threads is defined by the size of the CPU mask, or by the threading
+///     runtime if the mask is empty.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_set_num_threads(
+        dnnl_stream_attr_t attr, int nthr);
+
+/// Returns the number of threads of stream attributes.
+///
+/// @param attr Stream attributes.
+/// @param nthr Output number of threads.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_get_num_threads(
+        const_dnnl_stream_attr_t attr, int *nthr);
+
+/// Sets the CPU mask for parallel regions of primitives executed on a CPU
+/// stream. Thread `i` of a parallel region is bound to the logical CPU
+/// `cpus[i % ncpus]` while primitives execute. Supported for the OpenMP CPU
+/// runtime on Linux only.
+///
+/// @param attr Stream attributes.
+/// @param ncpus Number of CPUs in the mask. The value of 0 clears the mask.
+/// @param cpus Logical CPU indices.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_set_cpu_mask(
+        dnnl_stream_attr_t attr, int ncpus, const int *cpus);
+
+/// Returns the CPU mask of stream attributes.
+///
+/// @param attr Stream attributes.
+/// @param ncpus Output number of CPUs in the mask.
+/// @param cpus Output pointer to the logical CPU indices. The pointer is
+///     valid while the attributes are alive and not modified.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_attr_get_cpu_mask(
+        const_dnnl_stream_attr_t attr, int *ncpus, const int **cpus);
+
 /// Returns the engine of a stream object.
 ///
 /// @param stream Stream object.
@@ -314,8 +314,61 @@ struct handle_traits<dnnl_stream_t> {
         return dnnl_stream_destroy(p);
     }
 };
+
+template <>
+struct handle_traits<dnnl_stream_attr_t> {
+    static dnnl_status_t destructor(dnnl_stream_attr_t p) {
+        return dnnl_stream_attr_destroy(p);
+    }
+};
 /// @endcond
 
+/// Stream attributes.
+struct stream_attr : public handle<dnnl_stream_attr_t> {
+    using handle<dnnl_stream_attr_t>::handle;
+
+    /// Constructs default (empty) stream attributes.
+    stream_attr() {
+        dnnl_stream_attr_t result;
+        error::wrap_c_api(dnnl_stream_attr_create(&result),
+                "could not create stream attributes");
+        reset(result);
+    }
+
+    /// Returns the number of threads.
+    int get_num_threads() const {
+        int result;
+        error::wrap_c_api(dnnl_stream_attr_get_num_threads(get(), &result),
+                "could not get number of threads from stream attributes");
+        return result;
+    }
+
+    /// @copydoc dnnl_stream_attr_set_num_threads()
+    void set_num_threads(int nthr) {
+        error::wrap_c_api(dnnl_stream_attr_set_num_threads(get(), nthr),
+                "could not set number of threads of stream attributes");
+    }
+
+    /// Returns the CPU mask.
+    std::vector<int> get_cpu_mask() const {
+        int ncpus;
+        const int *cpus;
+        error::wrap_c_api(dnnl_stream_attr_get_cpu_mask(get(), &ncpus, &cpus),
+                "could not get CPU mask from stream attributes");
+        return std::vector<int>(cpus, cpus + ncpus);
+    }
+
+    /// Sets the CPU mask. Thread `i` of a parallel region is bound to the
+    /// logical CPU `cpus[i % cpus.size()]`.
+    ///
+    /// @param cpus Logical CPU indices. An empty vector clears the mask.
+    void set_cpu_mask(const std::vector<int> &cpus) {
+        error::wrap_c_api(dnnl_stream_attr_set_cpu_mask(get(),
+                                  static_cast<int>(cpus.size()), cpus.data()),
+                "could not set CPU mask of stream attributes");
+    }
+};
+
 /// An execution stream.
 struct stream : public handle<dnnl_stream_t> {
     using handle::handle;
@@ -332,6 +385,9 @@ struct stream : public handle<dnnl_stream_t> {
         /// Enables profiling capabilities.
         profiling = dnnl_stream_profiling,
 #endif
+        /// Splits the work of CPU primitives between NUMA nodes so that the
+        /// threads of each node access their own part of the weights.
+        numa_aware = dnnl_stream_numa_aware,
     };
 
     /// Constructs an empty stream. An empty stream cannot be used in any
@@ -352,6 +408,21 @@ struct stream : public handle<dnnl_stream_t> {
         reset(stream);
     }
 
+    /// Constructs a stream for the specified engine with behavior controlled
+    /// by the specified flags and attributes.
+    ///
+    /// @param aengine Engine to create the stream on.
+    /// @param aflags Flags controlling stream behavior.
+    /// @param attr Stream attributes.
+    stream(const engine &aengine, flags aflags, const stream_attr &attr) {
+        dnnl_stream_t stream;
+        error::wrap_c_api(
+                dnnl_stream_create_v2(&stream, aengine.get(),
+                        static_cast<dnnl_stream_flags_t>(aflags), attr.get()),
+                "could not create a stream");
+        reset(stream);
+    }
+
     /// Returns the associated engine.
     engine get_engine() const {
         dnnl_engine_t c_engine;
@@ -471,6 +542,48 @@ inline dnnl_accumulation_mode_t convert_to_c(accumulation_mode mode) {
 
 /// @} dnnl_api_accumulation_mode
 
+/// @addtogroup dnnl_api_service
+/// @{
+
+/// Statistics of a cache for the objects of the same kind and
+/// implementation.
+struct cache_stats {
+    /// Kind of the objects, for example a primitive kind.
+    std::string kind;
+    /// Implementation name of the objects (may be empty).
+    std::string impl;
+    /// Number of requests served by the cache.
+    uint64_t hits;
+    /// Number of objects created and added to the cache.
+    uint64_t misses;
+    /// Number of objects evicted from the cache.
+    uint64_t evictions;
+    /// Total creation time of the objects in milliseconds.
+    double creation_time_ms;
+};
+
+/// @cond DO_NOT_DOCUMENT_THIS
+inline std::vector<cache_stats> get_cache_stats(
+        dnnl_status_t (*query)(int *, dnnl_cache_stats_t *),
+        const char *message) {
+    int n = 0;
+    error::wrap_c_api(query(&n, nullptr), message);
+    std::vector<dnnl_cache_stats_t> c_stats(n);
+    if (n > 0) error::wrap_c_api(query(&n, c_stats.data()), message);
+
+    std::vector<cache_stats> stats;
+    stats.reserve(n);
+    for (int i = 0; i < n; i++) {
+        const auto &s = c_stats[i];
+        stats.push_back({s.kind, s.impl, s.hits, s.misses, s.evictions,
+                s.creation_time_ms});
+    }
+    return stats;
+}
+/// @endcond
+
+/// @} dnnl_api_service
+
 /// @} dnnl_api_common
 
 } // namespace dnnl
@@ -214,6 +214,9 @@ typedef enum {
     /// Enables profiling capabilities.
     dnnl_stream_profiling = 0x4U,
 #endif
+    /// Splits the work of CPU primitives between NUMA nodes so that the
+    /// threads of each node access their own part of the weights.
+    dnnl_stream_numa_aware = 0x8U,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_stream_flags_max = 0x7fff,
@@ -227,6 +230,14 @@ typedef struct dnnl_stream *dnnl_stream_t;
 /// A constant execution stream handle.
 typedef const struct dnnl_stream *const_dnnl_stream_t;
 
+/// @struct dnnl_stream_attr
+/// An opaque structure for stream attributes.
+struct dnnl_stream_attr;
+/// A stream attributes handle.
+typedef struct dnnl_stream_attr *dnnl_stream_attr_t;
+/// A constant stream attributes handle.
+typedef const struct dnnl_stream_attr *const_dnnl_stream_attr_t;
+
 /// @} dnnl_api_stream
 
 /// @addtogroup dnnl_api_service
@@ -243,6 +254,23 @@ typedef struct {
     unsigned gpu_runtime; ///< GPU runtime
 } dnnl_version_t;
 
+/// Maximum length of the names in #dnnl_cache_stats_t including the
+/// terminating null character.
+#define DNNL_CACHE_STATS_MAX_NAME_LEN 128
+
+/// Structure containing statistics of a cache for the objects of the same
+/// kind and implementation.
+typedef struct {
+    /// Kind of the objects, for example a primitive kind
+    char kind[DNNL_CACHE_STATS_MAX_NAME_LEN];
+    /// Implementation name of the objects (may be empty)
+    char impl[DNNL_CACHE_STATS_MAX_NAME_LEN];
+    uint64_t hits; ///< Number of requests served by the cache
+    uint64_t misses; ///< Number of objects created and added to the cache
+    uint64_t evictions; ///< Number of objects evicted from the cache
+    double creation_time_ms; ///< Total creation time of the objects
+} dnnl_cache_stats_t;
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_memory
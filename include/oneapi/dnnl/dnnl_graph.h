@@ -565,6 +565,130 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         size_t *num_inplace_pairs,
         const dnnl_graph_inplace_pair_t **inplace_pairs);
 
+/// Creates a memory plan for executing compiled partitions in the given order.
+/// The plan assigns offsets in a single buffer to the output tensors of the
+/// compiled partitions. Tensors with disjoint lifetimes share memory, and an
+/// output of an in-place pair reuses the buffer of its input if the input is
+/// not used afterwards. A tensor lives from the compiled partition that
+/// produces it until the last compiled partition that consumes it. Live-out
+/// tensors live until the end of the sequence. Input tensors which are not
+/// produced by any of the compiled partitions are not planned. The internal
+/// temporary memory of the compiled partitions is not planned either: it is
+/// allocated on execution through the allocator of the graph engine.
+///
+/// @param memory_plan Output memory plan.
+/// @param num_compiled_partitions The number of compiled partitions.
+/// @param compiled_partitions A list of compiled partitions in execution
+///     order. Each tensor ID must be produced by at most one compiled
+///     partition and must be produced before it is consumed.
+/// @param num_live_outs The number of live-out tensors.
+/// @param live_out_ids A list of IDs of the tensors which are read after the
+///     sequence is executed. Each of them must be produced by one of the
+///     compiled partitions. The memory of other tensors which are not
+///     consumed by any compiled partition is reused right after they are
+///     produced. If NULL, all tensors which are not consumed by any compiled
+///     partition are live-out.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_create(
+        dnnl_graph_memory_plan_t *memory_plan, size_t num_compiled_partitions,
+        const_dnnl_graph_compiled_partition_t *compiled_partitions,
+        size_t num_live_outs, const size_t *live_out_ids);
+
+/// Returns the size of the buffer required by a memory plan.
+///
+/// @param memory_plan The handle of target memory plan.
+/// @param size Output size of the buffer in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_get_size(
+        const_dnnl_graph_memory_plan_t memory_plan, size_t *size);
+
+/// Queries the offset of a tensor in the buffer of a memory plan. If the tensor
+/// ID is not planned, an error status #dnnl_invalid_arguments will be returned
+/// by the API.
+///
+/// @param memory_plan The handle of target memory plan.
+/// @param tid The unique id of required tensor.
+/// @param offset Output offset of the tensor in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_query_offset(
+        const_dnnl_graph_memory_plan_t memory_plan, size_t tid,
+        size_t *offset);
+
+/// Destroys a memory plan.
+///
+/// @param memory_plan The memory plan to be destroyed.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_destroy(
+        dnnl_graph_memory_plan_t memory_plan);
+
+/// Creates a schedule for executing compiled partitions concurrently on
+/// several streams. Each stream represents a group of threads, for example a
+/// CPU stream created with stream attributes which set the number of threads
+/// and the CPU mask. The compiled partitions are assigned to the streams
+/// according to their dependencies and to an estimate of their cost, so that
+/// independent compiled partitions can run at the same time on different
+/// streams. A compiled partition depends on the compiled partitions which
+/// produce its inputs.
+///
+/// @param schedule Output schedule.
+/// @param num_compiled_partitions The number of compiled partitions.
+/// @param compiled_partitions A list of compiled partitions in a valid
+///     sequential execution order. Each tensor ID must be produced by at most
+///     one compiled partition and must be produced before it is consumed.
+/// @param num_streams The number of streams.
+/// @param streams A list of distinct in-order streams of the engine kind of
+///     the compiled partitions. The streams must outlive the schedule. With
+///     the OpenMP CPU runtime, each of several CPU streams must be created
+///     with stream attributes which set the number of threads or the CPU
+///     mask.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_schedule_create(
+        dnnl_graph_schedule_t *schedule, size_t num_compiled_partitions,
+        const_dnnl_graph_compiled_partition_t *compiled_partitions,
+        size_t num_streams, dnnl_stream_t *streams);
+
+/// Queries the stream a compiled partition is assigned to by a schedule.
+///
+/// @param schedule The handle of target schedule.
+/// @param index The index of the compiled partition in the list used to
+///     create the schedule.
+/// @param stream_index Output index of the stream in the list used to create
+///     the schedule.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_schedule_query_stream_index(
+        const_dnnl_graph_schedule_t schedule, size_t index,
+        size_t *stream_index);
+
+/// Executes the compiled partitions of a schedule. The tensors are matched to
+/// the inputs and outputs of the compiled partitions by the IDs of their
+/// logical tensors. The function returns after all compiled partitions have
+/// completed. A schedule must not be executed from several threads at the
+/// same time.
+///
+/// @param schedule The handle of target schedule.
+/// @param num_tensors The number of tensors.
+/// @param tensors A list of tensors which contains every input and output of
+///     the compiled partitions, including the tensors which connect them.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_schedule_execute(
+        dnnl_graph_schedule_t schedule, size_t num_tensors,
+        const_dnnl_graph_tensor_t *tensors);
+
+/// Destroys a schedule.
+///
+/// @param schedule The schedule to be destroyed.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_schedule_destroy(
+        dnnl_graph_schedule_t schedule);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
@@ -718,6 +842,24 @@ dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_set_compiled_partition_cache_capacity(
         int capacity);
 
+/// Returns statistics of the compiled partition cache grouped by partition
+/// kind and backend name.
+///
+/// @param nstats On input, the number of elements in @p stats. On output,
+///     the number of returned elements, or the number of available elements
+///     if @p stats is NULL.
+/// @param stats Output array of statistics. May be NULL to query the number
+///     of elements.
+/// @returns #dnnl_invalid_arguments if @p nstats is NULL, and #dnnl_success
+///     on success.
+dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats);
+
+/// Resets statistics of the compiled partition cache.
+///
+/// @returns #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_reset_compiled_partition_cache_stats(void);
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache
@@ -97,6 +97,20 @@ struct graph_handle_traits<dnnl_graph_compiled_partition_t> {
     }
 };
 
+template <>
+struct graph_handle_traits<dnnl_graph_memory_plan_t> {
+    static dnnl_status_t destructor(dnnl_graph_memory_plan_t p) {
+        return dnnl_graph_memory_plan_destroy(p);
+    }
+};
+
+template <>
+struct graph_handle_traits<dnnl_graph_schedule_t> {
+    static dnnl_status_t destructor(dnnl_graph_schedule_t p) {
+        return dnnl_graph_schedule_destroy(p);
+    }
+};
+
 template <>
 struct graph_handle_traits<dnnl_graph_allocator_t> {
     static dnnl_status_t destructor(dnnl_graph_allocator_t p) {
@@ -113,6 +127,8 @@ DNNL_GRAPH_HANDLE_ALIAS(graph);
 DNNL_GRAPH_HANDLE_ALIAS(op);
 DNNL_GRAPH_HANDLE_ALIAS(tensor);
 DNNL_GRAPH_HANDLE_ALIAS(compiled_partition);
+DNNL_GRAPH_HANDLE_ALIAS(memory_plan);
+DNNL_GRAPH_HANDLE_ALIAS(schedule);
 DNNL_GRAPH_HANDLE_ALIAS(partition);
 
 #undef DNNL_GRAPH_HANDLE_ALIAS
@@ -760,6 +776,158 @@ public:
     }
 };
 
+/// A memory plan object. It assigns offsets in a single buffer to the output
+/// tensors of a sequence of compiled partitions so that tensors with disjoint
+/// lifetimes share memory. A tensor lives from the compiled partition that
+/// produces it until the last compiled partition that consumes it. Live-out
+/// tensors live until the end of the sequence. Input tensors which are not
+/// produced by any of the compiled partitions are not planned. The internal
+/// temporary memory of the compiled partitions is not planned either.
+class memory_plan : public memory_plan_handle {
+public:
+    /// Default constructor. Constructs an empty object.
+    memory_plan() = default;
+
+    /// Constructs a memory plan for executing compiled partitions in the
+    /// given order. All tensors which are not consumed by any of the
+    /// compiled partitions are live-out.
+    ///
+    /// @param compiled_partitions A list of compiled partitions in execution
+    ///     order.
+    memory_plan(const std::vector<compiled_partition> &compiled_partitions) {
+        init(compiled_partitions, nullptr, 0);
+    }
+
+    /// Constructs a memory plan for executing compiled partitions in the
+    /// given order with the given live-out tensors.
+    ///
+    /// @param compiled_partitions A list of compiled partitions in execution
+    ///     order.
+    /// @param live_out_ids A list of IDs of the tensors which are read after
+    ///     the sequence is executed. The memory of other tensors which are
+    ///     not consumed by any compiled partition is reused right after they
+    ///     are produced.
+    memory_plan(const std::vector<compiled_partition> &compiled_partitions,
+            const std::vector<size_t> &live_out_ids) {
+        // A non-null pointer is passed even for an empty list, which means
+        // that no tensor is live-out
+        static const size_t no_ids[1] = {0};
+        init(compiled_partitions,
+                live_out_ids.empty() ? no_ids : live_out_ids.data(),
+                live_out_ids.size());
+    }
+
+    /// Returns the size of the buffer required by the memory plan.
+    ///
+    /// @returns The size of the buffer in bytes.
+    size_t get_size() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_memory_plan_get_size(get(), &size),
+                "could not get the size of a memory plan");
+        return size;
+    }
+
+    /// Queries the offset of a tensor in the buffer of the memory plan. If
+    /// the tensor ID is not planned, an exception will be raised by the API.
+    ///
+    /// @param tid The unique id of required tensor.
+    /// @returns The offset of the tensor in bytes.
+    size_t query_offset(size_t tid) const {
+        size_t offset = 0;
+        error::wrap_c_api(
+                dnnl_graph_memory_plan_query_offset(get(), tid, &offset),
+                "could not query the offset of a tensor from a memory plan");
+        return offset;
+    }
+
+private:
+    void init(const std::vector<compiled_partition> &compiled_partitions,
+            const size_t *live_out_ids, size_t num_live_outs) {
+        std::vector<const_dnnl_graph_compiled_partition_t> c_cps;
+        c_cps.reserve(compiled_partitions.size());
+        for (const auto &cp : compiled_partitions) {
+            c_cps.push_back(cp.get());
+        }
+
+        dnnl_graph_memory_plan_t plan = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_memory_plan_create(&plan, c_cps.size(),
+                        c_cps.data(), num_live_outs, live_out_ids),
+                "could not create a memory plan");
+        reset(plan);
+    }
+};
+
+/// A schedule object. It executes compiled partitions concurrently on
+/// several streams, each of which represents a group of threads. The compiled
+/// partitions are assigned to the streams according to their dependencies and
+/// to an estimate of their cost, so that independent compiled partitions can
+/// run at the same time.
+class schedule : public schedule_handle {
+public:
+    /// Default constructor. Constructs an empty object.
+    schedule() = default;
+
+    /// Constructs a schedule for executing compiled partitions on streams.
+    ///
+    /// @param compiled_partitions A list of compiled partitions in a valid
+    ///     sequential execution order.
+    /// @param streams A list of distinct in-order streams. The streams must
+    ///     outlive the schedule.
+    schedule(const std::vector<compiled_partition> &compiled_partitions,
+            const std::vector<stream> &streams) {
+        std::vector<const_dnnl_graph_compiled_partition_t> c_cps;
+        c_cps.reserve(compiled_partitions.size());
+        for (const auto &cp : compiled_partitions) {
+            c_cps.push_back(cp.get());
+        }
+        std::vector<dnnl_stream_t> c_streams;
+        c_streams.reserve(streams.size());
+        for (const auto &strm : streams) {
+            c_streams.push_back(strm.get());
+        }
+
+        dnnl_graph_schedule_t sched = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_schedule_create(&sched, c_cps.size(), c_cps.data(),
+                        c_streams.size(), c_streams.data()),
+                "could not create a schedule");
+        reset(sched);
+    }
+
+    /// Queries the stream a compiled partition is assigned to.
+    ///
+    /// @param index The index of the compiled partition in the list used to
+    ///     create the schedule.
+    /// @returns The index of the stream in the list used to create the
+    ///     schedule.
+    size_t query_stream_index(size_t index) const {
+        size_t stream_index = 0;
+        error::wrap_c_api(dnnl_graph_schedule_query_stream_index(
+                                  get(), index, &stream_index),
+                "could not query the stream index from a schedule");
+        return stream_index;
+    }
+
+    /// Executes the compiled partitions of the schedule and waits for their
+    /// completion.
+    ///
+    /// @param tensors A list of tensors which contains every input and output
+    ///     of the compiled partitions. The tensors are matched by the IDs of
+    ///     their logical tensors.
+    void execute(const std::vector<tensor> &tensors) {
+        std::vector<const_dnnl_graph_tensor_t> c_tensors;
+        c_tensors.reserve(tensors.size());
+        for (const auto &t : tensors) {
+            c_tensors.push_back(t.get());
+        }
+
+        error::wrap_c_api(dnnl_graph_schedule_execute(
+                                  get(), c_tensors.size(), c_tensors.data()),
+                "could not execute the schedule");
+    }
+};
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_op Op
@@ -1578,6 +1746,18 @@ inline void set_compiled_partition_cache_capacity(int capacity) {
             "could not set compiled partition cache capacity");
 }
 
+/// @copydoc dnnl_graph_get_compiled_partition_cache_stats(int *nstats, dnnl_cache_stats_t *stats)
+inline std::vector<cache_stats> get_compiled_partition_cache_stats() {
+    return get_cache_stats(dnnl_graph_get_compiled_partition_cache_stats,
+            "could not get compiled partition cache statistics");
+}
+
+/// @copydoc dnnl_graph_reset_compiled_partition_cache_stats()
+inline void reset_compiled_partition_cache_stats() {
+    error::wrap_c_api(dnnl_graph_reset_compiled_partition_cache_stats(),
+            "could not reset compiled partition cache statistics");
+}
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache Constant Tensor Cache
@@ -473,6 +473,26 @@ typedef struct dnnl_graph_compiled_partition *dnnl_graph_compiled_partition_t;
 typedef const struct dnnl_graph_compiled_partition
         *const_dnnl_graph_compiled_partition_t;
 
+/// An opaque structure to describe a memory plan for a sequence of compiled
+/// partitions.
+struct dnnl_graph_memory_plan;
+
+/// A memory plan handle.
+typedef struct dnnl_graph_memory_plan *dnnl_graph_memory_plan_t;
+
+/// A constant memory plan handle.
+typedef const struct dnnl_graph_memory_plan *const_dnnl_graph_memory_plan_t;
+
+/// An opaque structure to describe a schedule of compiled partitions over
+/// streams.
+struct dnnl_graph_schedule;
+
+/// A schedule handle.
+typedef struct dnnl_graph_schedule *dnnl_graph_schedule_t;
+
+/// A constant schedule handle.
+typedef const struct dnnl_graph_schedule *const_dnnl_graph_schedule_t;
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_tensor
@@ -46,6 +46,29 @@ extern "C" {
 dnnl_status_t DNNL_API dnnl_threadpool_interop_stream_create(
         dnnl_stream_t *stream, dnnl_engine_t engine, void *threadpool);
 
+/// Creates an execution stream with specified threadpool and flags.
+///
+/// With the #dnnl_stream_out_of_order flag the primitive executions
+/// submitted to the stream are deferred until the stream is waited on. The
+/// executions are then run on the threadpool in an order that respects the
+/// data dependencies between them, which are inferred from their memory
+/// arguments. Independent executions may run concurrently on different
+/// threads of the threadpool.
+///
+/// @sa @ref dev_guide_threadpool
+///
+/// @param stream Output execution stream.
+/// @param engine Engine to create the execution stream on.
+/// @param threadpool Pointer to an instance of a C++ class that implements
+///     dnnl::threapdool_iface interface.
+/// @param flags Stream behavior flags. Either #dnnl_stream_in_order or
+///     #dnnl_stream_out_of_order (see #dnnl_stream_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_threadpool_interop_stream_create_v2(
+        dnnl_stream_t *stream, dnnl_engine_t engine, void *threadpool,
+        unsigned flags);
+
 /// Returns a threadpool to be used by the execution stream.
 ///
 /// @sa @ref dev_guide_threadpool
@@ -54,6 +54,27 @@ inline dnnl::stream make_stream(
     return dnnl::stream(c_stream);
 }
 
+/// Constructs an execution stream for the specified engine, threadpool, and
+/// flags.
+///
+/// @sa @ref dev_guide_threadpool
+///
+/// @param aengine Engine to create the stream on.
+/// @param threadpool Pointer to an instance of a C++ class that implements
+///     dnnl::threapdool_iface interface.
+/// @param aflags Stream flags. Either dnnl::stream::flags::in_order or
+///     dnnl::stream::flags::out_of_order.
+/// @returns An execution stream.
+inline dnnl::stream make_stream(const dnnl::engine &aengine,
+        threadpool_iface *threadpool, dnnl::stream::flags aflags) {
+    dnnl_stream_t c_stream;
+    dnnl::error::wrap_c_api(
+            dnnl_threadpool_interop_stream_create_v2(&c_stream, aengine.get(),
+                    threadpool, static_cast<unsigned>(aflags)),
+            "could not create stream");
+    return dnnl::stream(c_stream);
+}
+
 /// Returns the pointer to a threadpool that is used by an execution stream.
 ///
 /// @sa @ref dev_guide_threadpool
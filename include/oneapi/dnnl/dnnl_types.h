@@ -2538,6 +2538,33 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_future
+/// An opaque structure to describe a primitive which is being created
+/// asynchronously.
+struct dnnl_primitive_future;
+/// A primitive future handle.
+typedef struct dnnl_primitive_future *dnnl_primitive_future_t;
+/// A constant primitive future handle.
+typedef const struct dnnl_primitive_future *const_dnnl_primitive_future_t;
+
+/// @struct dnnl_prepared_primitive
+/// An opaque structure to describe a primitive with arguments bound for
+/// repeated execution.
+struct dnnl_prepared_primitive;
+/// A prepared primitive handle.
+typedef struct dnnl_prepared_primitive *dnnl_prepared_primitive_t;
+/// A constant prepared primitive handle.
+typedef const struct dnnl_prepared_primitive *const_dnnl_prepared_primitive_t;
+
+/// @struct dnnl_command_list
+/// An opaque structure to describe a sequence of primitive executions
+/// recorded on a stream.
+struct dnnl_command_list;
+/// A command list handle.
+typedef struct dnnl_command_list *dnnl_command_list_t;
+/// A constant command list handle.
+typedef const struct dnnl_command_list *const_dnnl_command_list_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
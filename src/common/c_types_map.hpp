@@ -25,6 +25,9 @@
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
 using primitive_desc_iface_t = dnnl_primitive_desc;
+using primitive_future_t = dnnl_primitive_future;
+using prepared_primitive_t = dnnl_prepared_primitive;
+using command_list_t = dnnl_command_list;
 
 namespace dnnl {
 namespace impl {
@@ -2144,8 +2147,10 @@ const stream_flags_t profiling = dnnl_stream_profiling;
 #else
 const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 #endif
+const stream_flags_t numa_aware = dnnl_stream_numa_aware;
 } // namespace stream_flags
 using stream_t = dnnl_stream;
+using stream_attr_t = dnnl_stream_attr;
 
 struct memory_storage_t;
 
@@ -18,17 +18,24 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <future>
+#include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "oneapi/dnnl/dnnl_common_types.h"
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/platform.hpp"
-#else
-#include <chrono>
 #endif
 
 #ifdef _WIN32
@@ -36,6 +43,7 @@
 #endif
 
 #include "rw_mutex.hpp"
+#include "utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -47,6 +55,54 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Replacement policies of the cache.
+// - lru: evicts the least recently used entry.
+// - cost_aware: GreedyDual policy that weighs the creation time of an entry
+//   against its footprint, so cheap entries are evicted before expensive ones
+//   while aging out the entries that are no longer used.
+enum class eviction_policy_t { lru, cost_aware };
+
+// Counters of the cached objects of the same kind and implementation.
+struct cache_stats_t {
+    std::string kind;
+    std::string impl;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    // In microseconds.
+    double creation_time = 0;
+};
+
+// Returns the kind and the implementation name of a cached object. The object
+// is nullptr if it's not created yet.
+template <typename K, typename C>
+using stats_name_t
+        = std::pair<std::string, std::string> (*)(const K &, const C *);
+
+// Copies the statistics to the user-provided array. If `stats` is nullptr,
+// only the number of entries is returned.
+inline status_t copy_cache_stats(const std::vector<cache_stats_t> &src,
+        int *nstats, dnnl_cache_stats_t *stats) {
+    if (nstats == nullptr) return status::invalid_arguments;
+    if (stats == nullptr) {
+        *nstats = (int)src.size();
+        return status::success;
+    }
+    const int n = std::min(*nstats, (int)src.size());
+    for (int i = 0; i < n; i++) {
+        snprintf(stats[i].kind, sizeof(stats[i].kind), "%s",
+                src[i].kind.c_str());
+        snprintf(stats[i].impl, sizeof(stats[i].impl), "%s",
+                src[i].impl.c_str());
+        stats[i].hits = src[i].hits;
+        stats[i].misses = src[i].misses;
+        stats[i].evictions = src[i].evictions;
+        stats[i].creation_time_ms = src[i].creation_time / 1e3;
+    }
+    *nstats = n;
+    return status::success;
+}
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -88,7 +144,13 @@ struct cache_t {
             // The requested object is NOT present in the cache therefore we
             // have to create it and notify the waiting threads once the
             // creation is done.
+            const auto start = std::chrono::steady_clock::now();
+            const size_t start_footprint = get_jit_code_footprint();
             cache_object_t cv = create(create_context);
+            const std::chrono::duration<double, std::micro> creation_time
+                    = std::chrono::steady_clock::now() - start;
+            const size_t footprint
+                    = get_jit_code_footprint() - start_footprint;
             if (cv.status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, cv.status});
@@ -106,6 +168,7 @@ struct cache_t {
                 // stored object. Therefore the pointers in the key may need
                 // updated.
                 update_entry(key, cv.get_value());
+                update_cost(key, creation_time.count(), footprint);
                 return cv;
             }
         }
@@ -115,15 +178,33 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
+    // Records the creation time in microseconds and the footprint in bytes
+    // of the created object.
+    virtual void update_cost(
+            const key_t &key, double creation_time, size_t footprint)
+            = 0;
+    // Cache hits take a read lock, which is contended by every thread that
+    // creates primitives, therefore the lock is sharded.
+    static utils::sharded_rw_mutex_t &rw_mutex() {
+        static utils::sharded_rw_mutex_t mutex;
         return mutex;
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy by default. The capacity is set in
+// entries and, optionally, in bytes of the object footprint. The cache counts
+// hits, misses and evictions grouped by names returned by `stats_name`.
+//
+// The recency of the entries is approximated in the CLOCK manner: a hit only
+// sets the reference bit of an entry if it is not set yet, so that the hits of
+// the same entry from many threads do not write to a shared cache line. The
+// timestamps of the referenced entries are updated at eviction time. For the
+// same reason, the hits of an entry are counted in several relaxed counters,
+// each of them used by a subset of the threads, and summed when the statistics
+// are queried.
 template <typename K, typename O, typename C,
-        key_merge_t<K, O> key_merge = nullptr>
+        key_merge_t<K, O> key_merge = nullptr,
+        stats_name_t<K, C> stats_name = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using lru_base_t = cache_t<K, O, C, key_merge>;
     using key_t = typename lru_base_t::key_t;
@@ -183,6 +264,69 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
         utils::lock_write_t lock_w(this->rw_mutex());
         capacity_ = capacity;
     }
+    // Overrides the measured creation time of an entry, used for testing.
+    void set_creation_time(const key_t &key, double creation_time) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        auto it = cache_mapper().find(key);
+        if (it == cache_mapper().end()) return;
+        it->second.creation_time_ = creation_time;
+        it->second.priority_.store(get_priority(it->second));
+    }
+
+    // Sets the limit on the total footprint of the entries. Zero means no
+    // limit.
+    void set_capacity_bytes(size_t capacity_bytes) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        capacity_bytes_ = capacity_bytes;
+        evict_excess_footprint();
+    }
+
+    size_t get_capacity_bytes() const {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        return capacity_bytes_;
+    }
+
+    size_t get_size_bytes() const {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        return size_bytes_;
+    }
+
+    std::vector<cache_stats_t> get_stats() const {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        auto stats = retired_stats_;
+        for (const auto &e : cache_mapper()) {
+            auto &s = get_stats_entry(stats, e.first, e.second.value_);
+            s.hits += e.second.get_hits();
+            if (e.second.misses_ == 0) continue;
+            s.misses += e.second.misses_;
+            s.creation_time += e.second.creation_time_;
+        }
+
+        std::vector<cache_stats_t> ret;
+        ret.reserve(stats.size());
+        for (auto &s : stats)
+            ret.push_back(std::move(s.second));
+        return ret;
+    }
+
+    void reset_stats() {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        retired_stats_.clear();
+        for (auto &e : cache_mapper()) {
+            for (auto &h : e.second.hits_)
+                h.count.store(0, std::memory_order_relaxed);
+            e.second.misses_ = 0;
+        }
+    }
+
+    void set_eviction_policy(eviction_policy_t policy) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        policy_ = policy;
+        // Start over the priorities of the entries.
+        inflation_ = 0;
+        for (auto &e : cache_mapper())
+            e.second.priority_.store(get_priority(e.second));
+    }
 
     int get_size() const override {
         utils::lock_read_t lock_r(this->rw_mutex());
@@ -200,7 +344,7 @@ protected:
             if (capacity_ == 0) { return value_t(); }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
+            auto e = get_future(key, /* is_hit = */ true);
             if (e.valid()) { return e; }
         }
 
@@ -215,7 +359,7 @@ protected:
 
         // Double check if the requested entry is present in the cache (unlikely
         // cache_hit).
-        auto e = get_future(key);
+        auto e = get_future(key, /* is_hit = */ true);
         if (!e.valid()) {
             // If the entry is missing in the cache then add it (cache_miss)
             add(key, value);
@@ -237,10 +381,13 @@ protected:
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
+        size_bytes_ -= it->second.footprint_;
         cache_mapper().erase(it);
     }
 
 private:
+    struct timed_entry_t;
+
     static size_t get_timestamp() {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
         return cpu::platform::get_timestamp();
@@ -273,38 +420,150 @@ private:
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    void update_cost(const key_t &key, double creation_time,
+            size_t footprint) override {
+        utils::lock_write_t lock_w(this->rw_mutex());
+
+        if (capacity_ == 0) { return; }
+
+        // See update_entry() for the cases when there is nothing to do.
+        auto it = cache_mapper().find(key);
+        if (it == cache_mapper().end()
+                || it->first.thread_id() != key.thread_id()) {
+            return;
+        }
 
+        // JIT code is allocated with page granularity, objects without JIT
+        // code are accounted as a single page.
+        const size_t page_size = (size_t)getpagesize();
+        auto &e = it->second;
+        size_bytes_ -= e.footprint_;
+        e.footprint_ = rnd_up(std::max(footprint, (size_t)1), page_size);
+        e.creation_time_ = creation_time;
+        e.misses_++;
+        size_bytes_ += e.footprint_;
+        e.priority_.store(get_priority(e));
+
+        evict_excess_footprint();
+    }
+
+    // GreedyDual priority: the creation time per unit of capacity on top of
+    // the inflation value, which is raised to the priority of every evicted
+    // entry. Entries that are still being created are not evicted first.
+    double get_priority(const timed_entry_t &e) const {
+        if (policy_ != eviction_policy_t::cost_aware) return 0;
+        if (e.creation_time_ < 0) return std::numeric_limits<double>::max();
+        const double size = capacity_bytes_ > 0
+                ? (double)e.footprint_ / (double)getpagesize()
+                : 1.0;
+        return inflation_ + e.creation_time_ / size;
+    }
+
+    using v_t = typename std::unordered_map<key_t, timed_entry_t>::value_type;
+
+    void evict(int n) {
         if (n == capacity_) {
+            for (const auto &e : cache_mapper())
+                retire_stats(e.first, e.second);
             cache_mapper().clear();
+            size_bytes_ = 0;
             return;
         }
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                // By default, load() and operator T use sequentially
-                // consistent memory ordering, which enforces writing
-                // the timestamps into registers in the same exact order
-                // they are read from the CPU cache line. Since eviction
-                // is performed under a write lock, this order is not
-                // important, therefore we can safely use the weakest
-                // memory ordering (relaxed). This brings about a few
-                // microseconds performance improvement for default
-                // cache capacity.
-                return left.second.timestamp_.load(std::memory_order_relaxed)
-                        < right.second.timestamp_.load(
+        for (v_t *e : get_eviction_order(n))
+            evict_entry(*e);
+    }
+
+    // Returns the `n` first entries to evict, in order, in a single pass over
+    // the cache.
+    std::vector<v_t *> get_eviction_order(size_t n) {
+        // The entries referenced since the previous eviction are treated as
+        // used at the same time, the most recently.
+        const size_t timestamp = get_timestamp();
+        std::vector<v_t *> order;
+        order.reserve(cache_mapper().size());
+        for (auto &e : cache_mapper()) {
+            order.push_back(&e);
+            if (!e.second.referenced_.load(std::memory_order_relaxed))
+                continue;
+            e.second.timestamp_.store(timestamp, std::memory_order_relaxed);
+            e.second.referenced_.store(false, std::memory_order_relaxed);
+        }
+
+        // Order by the smallest priority or timestamp
+        const bool cost_aware = policy_ == eviction_policy_t::cost_aware;
+        n = std::min(n, order.size());
+        std::partial_sort(order.begin(), order.begin() + n, order.end(),
+                [&](const v_t *left, const v_t *right) {
+                    // By default, load() and operator T use sequentially
+                    // consistent memory ordering, which enforces writing
+                    // the timestamps into registers in the same exact order
+                    // they are read from the CPU cache line. Since eviction
+                    // is performed under a write lock, this order is not
+                    // important, therefore we can safely use the weakest
+                    // memory ordering (relaxed). This brings about a few
+                    // microseconds performance improvement for default
+                    // cache capacity.
+                    if (cost_aware) {
+                        const double l = left->second.priority_.load(
+                                std::memory_order_relaxed);
+                        const double r = right->second.priority_.load(
                                 std::memory_order_relaxed);
-            });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+                        if (l != r) return l < r;
+                    }
+                    return left->second.timestamp_.load(
+                                   std::memory_order_relaxed)
+                            < right->second.timestamp_.load(
+                                    std::memory_order_relaxed);
+                });
+        order.resize(n);
+        return order;
+    }
+
+    void evict_entry(v_t &e) {
+        if (policy_ == eviction_policy_t::cost_aware
+                && e.second.creation_time_ >= 0)
+            inflation_ = e.second.priority_.load(std::memory_order_relaxed);
+        size_bytes_ -= e.second.footprint_;
+        retire_stats(e.first, e.second);
+        auto res = cache_mapper().erase(e.first);
+        MAYBE_UNUSED(res);
+        assert(res);
+    }
+
+    using stats_map_t = std::map<std::pair<std::string, std::string>,
+            cache_stats_t>;
+
+    static cache_stats_t &get_stats_entry(
+            stats_map_t &stats, const key_t &key, const value_t &value) {
+        // Entries that are being created are not waited for.
+        const bool is_ready = value.wait_for(std::chrono::seconds(0))
+                == std::future_status::ready;
+        auto name = (void *)stats_name == nullptr
+                ? std::pair<std::string, std::string>()
+                : stats_name(key, is_ready ? &value.get() : nullptr);
+        auto &s = stats[name];
+        s.kind = name.first;
+        s.impl = name.second;
+        return s;
+    }
+
+    // Keeps the counters of an evicted entry.
+    void retire_stats(const key_t &key, const timed_entry_t &e) {
+        auto &s = get_stats_entry(retired_stats_, key, e.value_);
+        s.hits += e.get_hits();
+        s.misses += e.misses_;
+        if (e.misses_ > 0) s.creation_time += e.creation_time_;
+        s.evictions++;
+    }
+
+    void evict_excess_footprint() {
+        if (capacity_bytes_ == 0 || size_bytes_ <= capacity_bytes_) return;
+        // The number of victims depends on their footprints, so all entries
+        // are ordered at once.
+        for (v_t *e : get_eviction_order(cache_mapper().size())) {
+            if (size_bytes_ <= capacity_bytes_) break;
+            evict_entry(*e);
         }
     }
     void add(const key_t &key, const value_t &value) {
@@ -322,23 +581,82 @@ private:
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        res.first->second.priority_.store(get_priority(res.first->second));
     }
-    value_t get_future(const key_t &key) {
+    value_t get_future(const key_t &key, bool is_hit = false) {
         auto it = cache_mapper().find(key);
         if (it == cache_mapper().end()) return value_t();
 
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+        // Only the first hit after an eviction writes the reference bit.
+        auto &e = it->second;
+        if (!e.referenced_.load(std::memory_order_relaxed))
+            e.referenced_.store(true, std::memory_order_relaxed);
+        if (is_hit)
+            e.hits_[get_hit_shard()].count.fetch_add(
+                    1, std::memory_order_relaxed);
+        if (policy_ == eviction_policy_t::cost_aware) {
+            // The priority changes only when the inflation is raised.
+            const double priority = get_priority(e);
+            if (e.priority_.load(std::memory_order_relaxed) != priority)
+                e.priority_.store(priority);
+        }
         // Return the entry
         return it->second.value_;
     }
 
     int capacity_;
+    eviction_policy_t policy_ = eviction_policy_t::lru;
+    size_t capacity_bytes_ = 0;
+    size_t size_bytes_ = 0;
+    // The inflation value of the cost-aware policy. It's modified under the
+    // write lock only.
+    double inflation_ = 0;
+    // Counters of the evicted entries.
+    stats_map_t retired_stats_;
+
+    // The number of hit counters per entry.
+    static constexpr int hit_shards_ = 8;
+
+    // Padded to a cache line, so that threads using different counters of
+    // the same entry do not write to a shared cache line.
+    struct hit_counter_t {
+        std::atomic<uint64_t> count {0};
+        char pad[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    // Threads are assigned to the counters in a round-robin manner.
+    static int get_hit_shard() {
+        static std::atomic<int> next_shard {0};
+        static thread_local const int shard
+                = next_shard.fetch_add(1, std::memory_order_relaxed)
+                % hit_shards_;
+        return shard;
+    }
+
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
+        // Set on a hit, cleared at eviction time.
+        std::atomic<bool> referenced_;
+        std::atomic<double> priority_;
+        // The creation cost is known once the object is created, a negative
+        // creation time marks the entries that are being created.
+        double creation_time_ = -1;
+        size_t footprint_ = 0;
+        hit_counter_t hits_[hit_shards_];
+        uint64_t misses_ = 0;
         timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+            : value_(value)
+            , timestamp_(timestamp)
+            , referenced_(false)
+            , priority_(0) {}
+
+        uint64_t get_hits() const {
+            uint64_t hits = 0;
+            for (const auto &h : hits_)
+                hits += h.count.load(std::memory_order_relaxed);
+            return hits;
+        }
     };
 
     std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
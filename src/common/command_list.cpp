@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "command_list.hpp"
+#include "prepared_primitive.hpp"
+#include "stream.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+status_t dnnl_command_list::append(const primitive_iface_t *primitive_iface,
+        int nargs, const dnnl_exec_arg_t *c_args) {
+    prepared_primitive_t *prepared_primitive = nullptr;
+    CHECK(primitive_prepare(
+            &prepared_primitive, primitive_iface, stream_, nargs, c_args));
+    commands_.emplace_back(prepared_primitive);
+    return success;
+}
+
+status_t dnnl_command_list::execute() {
+    if (stream_->is_recording()) return invalid_arguments;
+    // The hooks are called once for the whole sequence.
+    stream_->before_exec_hook();
+    status_t status = success;
+    for (auto &c : commands_) {
+        status = c->execute_with_bound_args();
+        if (status != success) break;
+    }
+    stream_->after_exec_hook();
+    return status;
+}
+
+status_t dnnl_command_list_get_length(
+        const command_list_t *command_list, int *length) {
+    if (utils::any_null(command_list, length)) return invalid_arguments;
+    *length = command_list->length();
+    return success;
+}
+
+status_t dnnl_command_list_execute(command_list_t *command_list) {
+    if (command_list == nullptr) return invalid_arguments;
+    return command_list->execute();
+}
+
+status_t dnnl_command_list_destroy(command_list_t *command_list) {
+    delete command_list;
+    return success;
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_COMMAND_LIST_HPP
+#define COMMON_COMMAND_LIST_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "prepared_primitive.hpp"
+#include "utils.hpp"
+
+// dnnl_command_list is a user facing entity that has an alias command_list_t
+// for internal use. It keeps a sequence of primitive executions recorded on a
+// stream. Every execution is kept as a prepared primitive, so the arguments
+// are converted and validated at recording time only, and the scratchpads
+// stay bound between the replays.
+struct dnnl_command_list : public dnnl::impl::c_compatible {
+    dnnl_command_list(dnnl::impl::stream_t *stream) : stream_(stream) {}
+
+    dnnl::impl::stream_t *stream() const { return stream_; }
+    int length() const { return (int)commands_.size(); }
+
+    dnnl::impl::status_t append(const primitive_iface_t *primitive_iface,
+            int nargs, const dnnl_exec_arg_t *c_args);
+
+    // Executes the recorded primitives in the order of recording with the
+    // current data handles of their memory objects.
+    dnnl::impl::status_t execute();
+
+private:
+    dnnl::impl::stream_t *stream_;
+    std::vector<std::unique_ptr<prepared_primitive_t>> commands_;
+
+    dnnl_command_list() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_command_list);
+};
+
+#endif
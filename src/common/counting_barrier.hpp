@@ -24,6 +24,8 @@
 #include <thread>
 #include <condition_variable>
 
+#include "common/spin_wait.hpp"
+
 namespace dnnl {
 namespace impl {
 
@@ -49,10 +51,25 @@ struct counting_barrier_t {
     }
 
     void wait() {
+        const bool with_stats = spin_wait::get_stats_enabled();
+        const double start_ms = with_stats ? spin_wait::now_ms() : 0;
+
+        // Spinning does not set the waiter bit, so the last notify() does
+        // not touch the mutex if the barrier is passed while spinning.
+        bool parked = false;
+        const int spin_count = spin_wait::get_spin_count();
+        for (int i = 0; i < spin_count && state_.load() != 0; i++)
+            std::this_thread::yield();
+
         auto s = state_.fetch_or(waiter_mask_);
-        if (s == 0) return;
-        std::unique_lock<std::mutex> l(m_);
-        cv_.wait(l, [this]() { return notified_; });
+        if (s != 0) {
+            std::unique_lock<std::mutex> l(m_);
+            cv_.wait(l, [this]() { return notified_; });
+            parked = true;
+        }
+
+        if (with_stats)
+            spin_wait::record_wait(spin_wait::now_ms() - start_ms, parked);
     }
 
 private:
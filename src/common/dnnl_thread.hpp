@@ -18,7 +18,9 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 #include "utils.hpp"
@@ -48,6 +50,10 @@
 #include "common/ittnotify.hpp"
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/platform.hpp"
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -241,6 +247,58 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
     balance211(ny, grp_nthr, grp_ithr, ny_start, ny_end);
 }
 
+/* Returns the NUMA node of thread `tid` when `team` threads are spread evenly
+ * between `nnodes` nodes in order, i.e. the threads of each node have
+ * consecutive indices as when they are bound to cores with OMP_PROC_BIND=close
+ * or spread. `node_tid` and `node_team` are the index of the thread within its
+ * node and the number of threads of the node. */
+template <typename U>
+int numa_node_of_thread(U team, U tid, int nnodes, U &node_tid, U &node_team) {
+    int node = 0;
+    U tid_start {0}, tid_end {team};
+    if (nnodes > 1 && team >= nnodes) {
+        for (; node < nnodes; node++) {
+            balance211(team, (U)nnodes, (U)node, tid_start, tid_end);
+            if (tid < tid_end) break;
+        }
+    }
+    node_tid = tid - tid_start;
+    node_team = tid_end - tid_start;
+    return node;
+}
+
+/* Splits `n` items between `team` threads in proportion to `weights`: thread
+ * `tid` gets about n * weights[tid] / sum(weights) items. All threads must
+ * pass the same weights. Null weights fall back to balance211(). */
+template <typename T, typename U>
+void balance_weighted(
+        T n, U team, U tid, const int *weights, T &n_start, T &n_end) {
+    if (!weights || team <= 1 || n == 0) {
+        balance211(n, team, tid, n_start, n_end);
+        return;
+    }
+    dim_t total = 0, before = 0;
+    for (U i = 0; i < team; i++) {
+        if (i < tid) before += weights[i];
+        total += weights[i];
+    }
+    n_start = static_cast<T>(static_cast<dim_t>(n) * before / total);
+    n_end = static_cast<T>(
+            static_cast<dim_t>(n) * (before + weights[tid]) / total);
+}
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+/* Splits `n` items between the threads of a parallel region in proportion to
+ * the throughput of the core types the threads run on. Same as balance211()
+ * on CPUs with a single core type. */
+template <typename T, typename U>
+void balance_by_core_type(T n, U team, U tid, T &n_start, T &n_end) {
+    balance_weighted(n, team, tid,
+            cpu::platform::get_thread_core_weights(static_cast<int>(team)),
+            n_start, n_end);
+}
+#endif
+
 /* Functions:
  *  - parallel(nthr, f)                  - executes f in parallel using at
  *                                         most nthr threads. If nthr equals
@@ -255,6 +313,13 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but the
+ *                                         iterations are scheduled
+ *                                         dynamically with work stealing
+ *  - parallel_nd_dynamic_ext(nthr, dims..., f)
+ *                                       - same as parallel_nd_ext, but the
+ *                                         iterations are scheduled
+ *                                         dynamically with work stealing
  */
 
 /* general parallelization */
@@ -647,6 +712,114 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* parallel_nd_dynamic section */
+// The dynamic flavor is meant for loops with a highly irregular cost per
+// iteration (groups of different sizes, rows with different number of
+// non-zero elements, etc.). The iteration space is split into chunks, and
+// each thread starts with the chunks of its balance211() range so that the
+// regular case keeps the static locality. Once its own range is exhausted, a
+// thread steals the remaining chunks from the ranges of the other threads.
+// A chunk is claimed with an atomic increment of the range counter, hence the
+// owner and the thieves never process the same chunk.
+namespace dynamic_nd_utils {
+struct range_t {
+    std::atomic<dim_t> next {0};
+    dim_t end = 0;
+    // Keeps the counters of different threads in different cache lines.
+    char pad[64 - sizeof(std::atomic<dim_t>) - sizeof(dim_t)];
+};
+
+// Calls f(ithr, nthr, start, end) for every chunk [start, end) processed by
+// the thread. Chunks are `chunk` iterations long except for the last one.
+static inline void parallel_chunks(int nthr, dim_t work_amount, dim_t chunk,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    nthr = adjust_num_threads(nthr, work_amount);
+    if (nthr == 0 || work_amount == 0) return;
+    if (chunk <= 0) {
+        // A few chunks per thread are enough to even the load out while
+        // keeping the contention on the counters low.
+        constexpr dim_t chunks_per_thr = 8;
+        chunk = nstl::max(dim_t(1), work_amount / (nthr * chunks_per_thr));
+    }
+    const dim_t nchunks = utils::div_up(work_amount, chunk);
+
+    // The state is shared, not captured by reference, since a threadpool may
+    // run the tasks asynchronously.
+    std::shared_ptr<range_t> ranges(
+            new range_t[nthr], std::default_delete<range_t[]>());
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        dim_t start {0}, end {0};
+        balance211(nchunks, (dim_t)nthr, (dim_t)ithr, start, end);
+        ranges.get()[ithr].next.store(start, std::memory_order_relaxed);
+        ranges.get()[ithr].end = end;
+    }
+
+    parallel(nthr, [=](int ithr, int nthr) {
+        for (int i = 0; i < nthr; i++) {
+            auto &r = ranges.get()[(ithr + i) % nthr];
+            // Skip the counter of a drained range without touching it.
+            while (r.next.load(std::memory_order_relaxed) < r.end) {
+                const dim_t ichunk
+                        = r.next.fetch_add(1, std::memory_order_relaxed);
+                if (ichunk >= r.end) break;
+                const dim_t start = ichunk * chunk;
+                const dim_t end = nstl::min(start + chunk, work_amount);
+                f(ithr, nthr, start, end);
+            }
+        }
+    });
+}
+} // namespace dynamic_nd_utils
+
+static inline void parallel_nd_dynamic_ext(
+        int nthr, dim_t D0, const std::function<void(int, int, dim_t)> &f) {
+    dynamic_nd_utils::parallel_chunks(nthr, D0, 0,
+            [=](int ithr, int nthr, dim_t start, dim_t end) {
+                for (dim_t d0 = start; d0 < end; ++d0)
+                    f(ithr, nthr, d0);
+            });
+}
+static inline void parallel_nd_dynamic_ext(int nthr, dim_t D0, dim_t D1,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    dynamic_nd_utils::parallel_chunks(nthr, D0 * D1, 0,
+            [=](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(ithr, nthr, d0, d1);
+                    utils::nd_iterator_step(d0, D0, d1, D1);
+                }
+            });
+}
+static inline void parallel_nd_dynamic_ext(int nthr, dim_t D0, dim_t D1,
+        dim_t D2,
+        const std::function<void(int, int, dim_t, dim_t, dim_t)> &f) {
+    dynamic_nd_utils::parallel_chunks(nthr, D0 * D1 * D2, 0,
+            [=](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(ithr, nthr, d0, d1, d2);
+                    utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+                }
+            });
+}
+
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    parallel_nd_dynamic_ext(0, D0, [=](int, int, dim_t d0) { f(d0); });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    parallel_nd_dynamic_ext(
+            0, D0, D1, [=](int, int, dim_t d0, dim_t d1) { f(d0, d1); });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    parallel_nd_dynamic_ext(0, D0, D1, D2,
+            [=](int, int, dim_t d0, dim_t d1, dim_t d2) { f(d0, d1, d2); });
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -153,7 +153,8 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     }
 
     bool is_cache_blob_supported() const {
-        if (kind() != dnnl::impl::engine_kind::gpu) return false;
+        if (kind() == dnnl::impl::engine_kind::cpu)
+            return runtime_kind() != dnnl::impl::runtime_kind::sycl;
         if (!dnnl::impl::utils::one_of(runtime_kind(),
                     dnnl::impl::runtime_kind::ocl,
                     dnnl::impl::runtime_kind::ze))
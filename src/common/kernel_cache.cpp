@@ -48,6 +48,11 @@ struct iface_t::cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    std::vector<utils::cache_stats_t> get_stats() const {
+        return cache_.get_stats();
+    }
+    void reset_stats() { cache_.reset_stats(); }
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
         // Always try to fetch the kernel from the cache. There's no scenario
@@ -57,7 +62,14 @@ struct iface_t::cache_t {
     }
 
 private:
-    utils::lru_cache_t<key_t, value_t, result_t> cache_;
+    // Kernel keys are opaque, so all kernels are accounted together.
+    static std::pair<std::string, std::string> get_stats_name(
+            const key_t &, const result_t *) {
+        return {"kernel", ""};
+    }
+
+    utils::lru_cache_t<key_t, value_t, result_t, nullptr, get_stats_name>
+            cache_;
 };
 
 iface_t get() {
@@ -83,6 +95,14 @@ int iface_t::get_size() const {
     return cache_.get_size();
 }
 
+std::vector<utils::cache_stats_t> iface_t::get_stats() const {
+    return cache_.get_stats();
+}
+
+void iface_t::reset_stats() {
+    cache_.reset_stats();
+}
+
 iface_t::result_t iface_t::get_or_create(
         const key_t &key, create_func_t create, void *create_context) {
     auto r = cache_.get_or_create(key, create, create_context);
@@ -92,3 +112,19 @@ iface_t::result_t iface_t::get_or_create(
 } // namespace kernel_cache
 } // namespace impl
 } // namespace dnnl
+
+dnnl::impl::status_t dnnl_get_kernel_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats) {
+    std::vector<dnnl::impl::utils::cache_stats_t> s;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    s = dnnl::impl::kernel_cache::get().get_stats();
+#endif
+    return dnnl::impl::utils::copy_cache_stats(s, nstats, stats);
+}
+
+dnnl::impl::status_t dnnl_reset_kernel_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::kernel_cache::get().reset_stats();
+#endif
+    return dnnl::impl::status::success;
+}
@@ -20,11 +20,17 @@
 #include <cstddef>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include "c_types_map.hpp"
 
 namespace dnnl {
 namespace impl {
+
+namespace utils {
+struct cache_stats_t;
+} // namespace utils
+
 namespace kernel_cache {
 
 struct key_impl_t {
@@ -125,6 +131,8 @@ struct iface_t {
     status_t set_capacity(int capacity);
     int get_capacity() const;
     int get_size() const;
+    std::vector<utils::cache_stats_t> get_stats() const;
+    void reset_stats();
 
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context);
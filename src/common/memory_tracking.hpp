@@ -234,6 +234,7 @@ enum {
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
+    key_gated_mlp_buffer,
     key_gemm_asm_tmp_buffer,
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
@@ -278,6 +279,7 @@ enum {
     key_matmul_dst_scales,
     key_matmul_sparse_tmp_ptr,
     key_matmul_dyn_scale_space,
+    key_matmul_grouped_buffer,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -330,6 +332,7 @@ enum {
     key_sdpa_dK_reduction,
     key_sdpa_dV_reduction,
     key_sdpa_bwd_strides,
+    key_sdpa_fwd_buffer,
     key_softmax_dst_scales,
     key_softmax_reduction,
     key_softmax_interim_store,
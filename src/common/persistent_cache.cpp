@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/engine.hpp"
+#include "common/persistent_cache.hpp"
+#include "common/primitive.hpp"
+#include "common/serialization.hpp"
+#include "common/sha256.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+// Bump the version when the file layout changes.
+constexpr char file_magic[8] = {'D', 'N', 'N', 'L', 'P', 'C', '0', '2'};
+
+std::mutex &dir_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+setting_t<std::string> &dir_setting() {
+    static setting_t<std::string> dir;
+    return dir;
+}
+
+// Returns the ID of the cache entry for `pd` or an empty vector if the
+// primitive descriptor cannot be stored in the persistent cache.
+std::vector<uint8_t> get_entry_id(
+        engine_t *engine, const primitive_desc_t *pd) {
+    const auto &blob_id = pd->get_cache_blob_id(engine);
+    if (blob_id.empty()) return {};
+
+    serialization_stream_t sstream;
+    sstream.append_array(blob_id.size(), blob_id.data());
+    // JIT-generated code depends on the ISA the library dispatches to.
+    if (engine->kind() == engine_kind::cpu)
+        sstream.append(dnnl_get_effective_cpu_isa());
+    return sstream.get_data();
+}
+
+std::string get_entry_path(
+        const std::string &dir, const std::vector<uint8_t> &id) {
+    const size_t hash = serialization_stream_t::from_data(id).get_hash();
+    char name[32];
+    snprintf(name, sizeof(name), "%016zx.dnnl", hash);
+    return dir + "/" + name;
+}
+
+bool read_bytes(FILE *f, void *ptr, size_t size) {
+    return std::fread(ptr, 1, size, f) == size;
+}
+
+bool write_bytes(FILE *f, const void *ptr, size_t size) {
+    return std::fwrite(ptr, 1, size, f) == size;
+}
+
+// Opens an existing entry for reading. The directory may be writable by other
+// users, so on POSIX systems an entry is only used if it is a regular file,
+// not a symbolic link, owned by the effective user and not writable by the
+// group and others.
+FILE *open_entry(const std::string &path) {
+#ifdef _WIN32
+    return fopen(path.c_str(), "rb");
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0) return nullptr;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_uid != geteuid()
+            || (st.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    FILE *f = fdopen(fd, "rb");
+    if (!f) close(fd);
+    return f;
+#endif
+}
+
+// Creates a new file readable and writable by the owner only. Fails if the
+// file exists.
+FILE *create_entry(const std::string &path) {
+#ifdef _WIN32
+    return fopen(path.c_str(), "wb");
+#else
+    const int fd = open(path.c_str(),
+            O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (fd < 0) return nullptr;
+    FILE *f = fdopen(fd, "wb");
+    if (!f) close(fd);
+    return f;
+#endif
+}
+
+sha256_t::digest_t get_blob_digest(const std::vector<uint8_t> &blob) {
+    sha256_t sha;
+    sha.update(blob.data(), blob.size());
+    return sha.finalize();
+}
+
+// Returns a suffix that is unique across threads and processes.
+std::string get_tmp_suffix() {
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    const size_t tid
+            = std::hash<std::thread::id> {}(std::this_thread::get_id());
+    return "." + std::to_string(pid) + "." + std::to_string(tid) + ".tmp";
+}
+
+} // namespace
+
+std::string get_dir() {
+    std::lock_guard<std::mutex> g(dir_mutex());
+    auto &dir = dir_setting();
+    if (!dir.initialized()) {
+        const int len = 4096;
+        char buf[len];
+        if (getenv("ONEDNN_PRIMITIVE_CACHE_DIR", buf, len) > 0
+                || getenv("DNNL_PRIMITIVE_CACHE_DIR", buf, len) > 0)
+            dir.set(buf);
+        else
+            dir.set(std::string());
+    }
+    return dir.get();
+}
+
+status_t set_dir(const char *dir) {
+    std::lock_guard<std::mutex> g(dir_mutex());
+    dir_setting().set(dir ? std::string(dir) : std::string());
+    return status::success;
+}
+
+bool load(engine_t *engine, const primitive_desc_t *pd,
+        std::vector<uint8_t> &blob) {
+    if (!engine->is_cache_blob_supported()) return false;
+
+    const std::string dir = get_dir();
+    if (dir.empty()) return false;
+
+    const auto id = get_entry_id(engine, pd);
+    if (id.empty()) return false;
+
+    const std::string path = get_entry_path(dir, id);
+    FILE *f = open_entry(path);
+    if (!f) return false;
+
+    // The blob size read from the file is checked against the file size
+    // before allocating the blob.
+    bool ok = std::fseek(f, 0, SEEK_END) == 0;
+    const long file_size = ok ? std::ftell(f) : -1;
+    ok = ok && file_size > 0 && std::fseek(f, 0, SEEK_SET) == 0;
+    char magic[sizeof(file_magic)];
+    ok = ok && read_bytes(f, magic, sizeof(magic))
+            && std::memcmp(magic, file_magic, sizeof(magic)) == 0;
+
+    uint64_t id_size = 0;
+    ok = ok && read_bytes(f, &id_size, sizeof(id_size))
+            && id_size == id.size();
+    if (ok) {
+        std::vector<uint8_t> stored_id(id.size());
+        ok = read_bytes(f, stored_id.data(), stored_id.size())
+                && stored_id == id;
+    }
+
+    sha256_t::digest_t digest;
+    ok = ok && read_bytes(f, digest.data(), digest.size());
+
+    uint64_t blob_size = 0;
+    ok = ok && read_bytes(f, &blob_size, sizeof(blob_size)) && blob_size > 0
+            && blob_size <= static_cast<uint64_t>(file_size);
+    if (ok) {
+        blob.resize(blob_size);
+        ok = read_bytes(f, blob.data(), blob.size())
+                && get_blob_digest(blob) == digest;
+    }
+    std::fclose(f);
+
+    if (!ok) blob.clear();
+    return ok;
+}
+
+void store(engine_t *engine, const primitive_t &primitive) {
+    if (!engine->is_cache_blob_supported()) return;
+
+    const std::string dir = get_dir();
+    if (dir.empty()) return;
+
+    const auto id = get_entry_id(engine, primitive.pd().get());
+    if (id.empty()) return;
+
+    size_t blob_size = 0;
+    if (primitive.get_cache_blob_size(engine, &blob_size) != status::success
+            || blob_size == 0)
+        return;
+    std::vector<uint8_t> blob(blob_size);
+    cache_blob_t cache_blob(blob.data(), blob.size());
+    if (primitive.get_cache_blob(engine, cache_blob) != status::success)
+        return;
+
+    // The entry is written to a temporary file first and then renamed so
+    // that concurrent readers (including other processes) never observe a
+    // partially written entry.
+    const std::string path = get_entry_path(dir, id);
+    const std::string tmp_path = path + get_tmp_suffix();
+    FILE *f = create_entry(tmp_path);
+    if (!f) return;
+
+    const uint64_t id_size = id.size();
+    const auto digest = get_blob_digest(blob);
+    const uint64_t blob_size_u64 = blob.size();
+    bool ok = write_bytes(f, file_magic, sizeof(file_magic))
+            && write_bytes(f, &id_size, sizeof(id_size))
+            && write_bytes(f, id.data(), id.size())
+            && write_bytes(f, digest.data(), digest.size())
+            && write_bytes(f, &blob_size_u64, sizeof(blob_size_u64))
+            && write_bytes(f, blob.data(), blob.size());
+    ok = (std::fclose(f) == 0) && ok;
+
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl_status_t dnnl_set_primitive_cache_dir(const char *dir) {
+    return dnnl::impl::persistent_cache::set_dir(dir);
+}
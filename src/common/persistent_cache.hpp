@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_t;
+struct primitive_desc_t;
+
+// On-disk persistent primitive cache.
+//
+// The cache is opt-in: it is enabled when a directory is provided either via
+// the ONEDNN_PRIMITIVE_CACHE_DIR environment variable or via
+// dnnl_set_primitive_cache_dir(). Each entry is stored in a separate file
+// which holds the cache blob of a primitive. The file name is derived from
+// the hash of the primitive descriptor cache blob ID, which captures the
+// operation descriptor, attributes, implementation, device, and library
+// version. The engine ISA is mixed into the hash for CPU engines. The full
+// ID is stored in the file and verified on load to rule out hash collisions,
+// and a SHA-256 digest of the blob is verified to reject corrupted entries.
+//
+// On POSIX systems, entries are created readable and writable by the owner
+// only, and an entry is loaded only if it is a regular file owned by the
+// effective user and not writable by the group and others.
+//
+// Only engines that support cache blobs participate in the persistent cache.
+namespace persistent_cache {
+
+// Returns the cache directory or an empty string if the cache is disabled.
+std::string get_dir();
+status_t set_dir(const char *dir);
+
+// Reads a cache blob for @p pd from the cache directory. Returns `true` and
+// fills @p blob if a valid entry has been found.
+bool load(engine_t *engine, const primitive_desc_t *pd,
+        std::vector<uint8_t> &blob);
+
+// Writes the cache blob of @p primitive to the cache directory. Failures are
+// not fatal and are ignored since the entry can always be re-created.
+void store(engine_t *engine, const primitive_t &primitive);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+
+#if defined(DNNL_ENABLE_ITT_TASKS)
+#include "ittnotify.hpp"
+#endif
+
+#include "memory.hpp"
+#include "prepared_primitive.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_iface.hpp"
+#include "stream.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+dnnl_prepared_primitive::dnnl_prepared_primitive(
+        const primitive_iface_t *primitive_iface, stream_t *stream,
+        exec_args_t &&args, std::vector<memory_t *> &&slots)
+    : primitive_iface_(const_cast<primitive_iface_t *>(primitive_iface))
+    , stream_(stream)
+    , ctx_(stream, std::move(args))
+    , slots_(std::move(slots)) {
+    primitive_iface_->retain();
+}
+
+dnnl_prepared_primitive::~dnnl_prepared_primitive() {
+    primitive_iface_->release();
+}
+
+bool dnnl_prepared_primitive::use_regular_path() const {
+    if (msan_enabled) return true;
+#if defined(DNNL_ENABLE_ITT_TASKS)
+    if (itt::get_itt(itt::__itt_task_level_low)) return true;
+#endif
+    return get_verbose(verbose_t::exec_profile,
+            prim_kind2_comp_kind(primitive_iface_->pd()->impl()->kind()));
+}
+
+status_t dnnl_prepared_primitive::execute(int nhandles, void *const *handles) {
+    if (stream_->is_recording()) return invalid_arguments;
+    for (int i = 0; i < nhandles; i++) {
+        if (slots_[i] == nullptr) continue;
+        CHECK(slots_[i]->set_data_handle(handles[i]));
+    }
+
+    stream_->before_exec_hook();
+    const status_t status = execute_with_bound_args();
+    stream_->after_exec_hook();
+
+    return status;
+}
+
+status_t dnnl_prepared_primitive::execute_with_bound_args() {
+    status_t status = success;
+    if (use_regular_path()) {
+        status = primitive_execute(primitive_iface_, ctx_);
+        // The regular path binds a new scratchpad grantor.
+        is_bound_ = false;
+    } else {
+        const auto *storage = primitive_iface_->scratchpad_memory_storage(ctx_);
+        void *handle = storage ? storage->data_handle() : nullptr;
+        if (is_bound_ && storage == scratchpad_storage_
+                && handle == scratchpad_handle_) {
+            status = primitive_iface_->execute_bound(ctx_);
+        } else {
+            status = primitive_iface_->execute(ctx_, storage);
+            is_bound_ = true;
+            scratchpad_storage_ = storage;
+            scratchpad_handle_ = handle;
+        }
+    }
+    return status;
+}
+
+namespace dnnl {
+namespace impl {
+
+bool is_prepared_execution_supported(const stream_t *stream) {
+    return DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+            && stream->engine()->kind() == engine_kind::cpu
+            && !(stream->flags() & stream_flags::out_of_order);
+}
+
+status_t primitive_prepare(prepared_primitive_t **prepared_primitive,
+        const primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    bool ok = !utils::any_null(prepared_primitive, primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine()
+            && nargs >= 0 && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    if (!is_prepared_execution_supported(stream)) return unimplemented;
+
+    exec_args_t args;
+    CHECK(cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args));
+
+    std::vector<memory_t *> slots(nargs, nullptr);
+    for (int i = 0; i < nargs; i++) {
+        auto *mem = c_args[i].memory;
+        if (mem == nullptr
+                || memory_desc_wrapper(mem->md()).is_host_scalar_desc())
+            continue;
+        slots[i] = mem;
+    }
+
+    *prepared_primitive = new prepared_primitive_t(
+            primitive_iface, stream, std::move(args), std::move(slots));
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+status_t dnnl_primitive_prepare(prepared_primitive_t **prepared_primitive,
+        const primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    return primitive_prepare(
+            prepared_primitive, primitive_iface, stream, nargs, c_args);
+}
+
+status_t dnnl_prepared_primitive_execute(
+        prepared_primitive_t *prepared_primitive, int nhandles,
+        void *const *handles) {
+    if (prepared_primitive == nullptr) return invalid_arguments;
+    bool ok = IMPLICATION(nhandles != 0,
+            nhandles == prepared_primitive->nslots() && handles != nullptr);
+    if (!ok) return invalid_arguments;
+    return prepared_primitive->execute(nhandles, handles);
+}
+
+status_t dnnl_prepared_primitive_destroy(
+        prepared_primitive_t *prepared_primitive) {
+    delete prepared_primitive;
+    return success;
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PREPARED_PRIMITIVE_HPP
+#define COMMON_PREPARED_PRIMITIVE_HPP
+
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_exec_types.hpp"
+#include "utils.hpp"
+
+// dnnl_prepared_primitive is a user facing entity that has an alias
+// prepared_primitive_t for internal use. It keeps an execution context with
+// the arguments converted and validated once, so that repeated executions
+// only update the data handles of the bound memory objects. After the first
+// execution, the scratchpad grantor and the resource mapper stay bound to the
+// context until the scratchpad storage changes.
+struct dnnl_prepared_primitive : public dnnl::impl::c_compatible {
+    dnnl_prepared_primitive(const primitive_iface_t *primitive_iface,
+            dnnl::impl::stream_t *stream, dnnl::impl::exec_args_t &&args,
+            std::vector<dnnl::impl::memory_t *> &&slots);
+    ~dnnl_prepared_primitive();
+
+    int nslots() const { return (int)slots_.size(); }
+
+    dnnl::impl::status_t execute(int nhandles, void *const *handles);
+
+    // Executes the primitive with the current data handles of the bound
+    // memory objects. The caller is responsible for calling the execution
+    // hooks of the stream.
+    dnnl::impl::status_t execute_with_bound_args();
+
+private:
+    primitive_iface_t *primitive_iface_;
+    dnnl::impl::stream_t *stream_;
+    dnnl::impl::exec_ctx_t ctx_;
+    // Memory objects in the order of the arguments passed at preparation.
+    // Dummy arguments and host-side scalars have no data handles to update
+    // and are kept as nullptr.
+    std::vector<dnnl::impl::memory_t *> slots_;
+
+    // The scratchpad storage and its data handle the context is bound to.
+    // A global scratchpad may be reallocated by other primitives.
+    bool is_bound_ = false;
+    const dnnl::impl::memory_storage_t *scratchpad_storage_ = nullptr;
+    void *scratchpad_handle_ = nullptr;
+
+    // Verbose, ITT and sanitizer instrumentation is done by the regular
+    // execution path only.
+    bool use_regular_path() const;
+
+    dnnl_prepared_primitive() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_prepared_primitive);
+};
+
+namespace dnnl {
+namespace impl {
+
+// A prepared execution reuses the same context, which must not be captured by
+// deferred or asynchronous executions.
+bool is_prepared_execution_supported(const stream_t *stream);
+
+status_t primitive_prepare(prepared_primitive_t **prepared_primitive,
+        const primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *c_args);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
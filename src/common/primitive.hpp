@@ -20,11 +20,13 @@
 #include "common/c_types_map.hpp"
 #include "common/cache_blob.hpp"
 #include "common/cache_hit_types.hpp"
+#include "common/persistent_cache.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_exec_types.hpp"
 
 #include <cassert>
 #include <type_traits>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
@@ -53,15 +55,14 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Implementations that support cache blobs override both functions.
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t create_resource(
@@ -101,10 +102,30 @@ protected:
 
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
+            // On a primitive cache miss, try the persistent cache first and
+            // fall back to the regular creation if the entry is missing or
+            // cannot be used.
+            if (!c.cache_blob) {
+                std::vector<uint8_t> blob;
+                if (persistent_cache::load(c.engine, c.pd, blob)) {
+                    std::shared_ptr<primitive_t> p
+                            = std::make_shared<impl_type>(c.pd);
+                    status_t status = p->init(c.engine, c.use_global_scratchpad,
+                            cache_blob_t(blob.data(), blob.size()));
+                    if (status == status::success) {
+                        c.cache_status = cache_state_t::persistent_hit;
+                        return primitive_cache_iface_t::result_t {
+                                std::move(p), status};
+                    }
+                }
+            }
+
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
             c.cache_status = p->creation_cache_state();
+            if (status == status::success && !c.cache_blob)
+                persistent_cache::store(c.engine, *p);
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
         auto result = global_primitive_cache.get_or_create(
@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
 #include "primitive_cache.hpp"
 #include "c_types_map.hpp"
 #include "cache_utils.hpp"
@@ -27,7 +34,7 @@
 namespace dnnl {
 namespace impl {
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy by default
 struct primitive_cache_t {
     using key_t = primitive_hashing::key_t;
     using result_t = primitive_cache_iface_t::result_t;
@@ -43,6 +50,18 @@ struct primitive_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    void set_capacity_bytes(size_t capacity_bytes) {
+        cache_.set_capacity_bytes(capacity_bytes);
+    }
+    void set_eviction_policy(utils::eviction_policy_t policy) {
+        cache_.set_eviction_policy(policy);
+    }
+
+    std::vector<utils::cache_stats_t> get_stats() const {
+        return cache_.get_stats();
+    }
+    void reset_stats() { cache_.reset_stats(); }
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
@@ -59,14 +78,28 @@ private:
         key.op_desc_ = pd->op_desc();
         key.attr_ = pd->attr();
     }
+    static std::pair<std::string, std::string> get_stats_name(
+            const key_t &key, const result_t *result) {
+        const char *impl = result && !result->is_empty()
+                ? result->value->pd()->name()
+                : "";
+        return {dnnl_prim_kind2str(key.primitive_kind_), impl};
+    }
     // Used for testing.
     friend size_t set_primitive_cache_capacity_without_clearing(
             size_t capacity);
     void set_capacity_without_clearing(int capacity) {
         cache_.set_capacity_without_clearing(capacity);
     }
+    friend void set_primitive_creation_time(
+            const key_t &key, double creation_time);
+    void set_creation_time(const key_t &key, double creation_time) {
+        cache_.set_creation_time(key, creation_time);
+    }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    utils::lru_cache_t<key_t, primitive_t, result_t, update_key,
+            get_stats_name>
+            cache_;
 };
 
 primitive_cache_t &global_primitive_cache() {
@@ -77,6 +110,19 @@ primitive_cache_t &global_primitive_cache() {
     static const int capacity = 0;
 #endif
     static primitive_cache_t cache(capacity);
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    static const bool configured = [&] {
+        if (getenv_string_user("PRIMITIVE_CACHE_EVICTION_POLICY") == "cost")
+            cache.set_eviction_policy(utils::eviction_policy_t::cost_aware);
+        const std::string capacity_bytes
+                = getenv_string_user("PRIMITIVE_CACHE_CAPACITY_BYTES");
+        if (!capacity_bytes.empty())
+            cache.set_capacity_bytes(
+                    std::strtoull(capacity_bytes.c_str(), nullptr, 10));
+        return true;
+    }();
+    MAYBE_UNUSED(configured);
+#endif
     return cache;
 }
 
@@ -90,6 +136,11 @@ size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     return old_capacity;
 }
 
+void set_primitive_creation_time(
+        const primitive_hashing::key_t &key, double creation_time) {
+    global_primitive_cache().set_creation_time(key, creation_time);
+}
+
 status_t primitive_cache_iface_t::set_capacity(int capacity) {
     return cache_.set_capacity(capacity);
 }
@@ -146,6 +197,22 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
 
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats) {
+    std::vector<dnnl::impl::utils::cache_stats_t> s;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    s = dnnl::impl::global_primitive_cache().get_stats();
+#endif
+    return dnnl::impl::utils::copy_cache_stats(s, nstats, stats);
+}
+
+dnnl::impl::status_t dnnl_reset_primitive_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::global_primitive_cache().reset_stats();
+#endif
+    return dnnl::impl::status::success;
+}
+
 // Undocumented API declared in primitive_cache_test_api.hpp
 using namespace dnnl;
 using namespace dnnl::impl;
@@ -177,3 +244,25 @@ size_t dnnl_test_set_primitive_cache_capacity_without_clearing(
 #endif
     return size_t(0);
 }
+
+status_t dnnl_test_set_primitive_cache_eviction_policy(
+        int cost_aware, size_t capacity_bytes) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    global_primitive_cache().set_eviction_policy(cost_aware
+                    ? utils::eviction_policy_t::cost_aware
+                    : utils::eviction_policy_t::lru);
+    global_primitive_cache().set_capacity_bytes(capacity_bytes);
+#endif
+    return impl::status::success;
+}
+
+status_t dnnl_test_set_primitive_creation_time(
+        const primitive_iface_t *p_iface, double creation_time) {
+    if (p_iface == nullptr) return impl::status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    primitive_hashing::key_t key(
+            p_iface->pd()->impl().get(), p_iface->pd()->engine());
+    set_primitive_creation_time(key, creation_time);
+#endif
+    return impl::status::success;
+}
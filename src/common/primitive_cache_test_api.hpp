@@ -25,6 +25,10 @@ int DNNL_API dnnl_test_is_primitive_in_cache(const_dnnl_primitive_t p_iface);
 int DNNL_API dnnl_test_is_pd_in_cache(const_dnnl_primitive_desc_t pd_iface);
 size_t DNNL_API dnnl_test_set_primitive_cache_capacity_without_clearing(
         size_t capacity);
+dnnl_status_t DNNL_API dnnl_test_set_primitive_cache_eviction_policy(
+        int cost_aware, size_t capacity_bytes);
+dnnl_status_t DNNL_API dnnl_test_set_primitive_creation_time(
+        const_dnnl_primitive_t p_iface, double creation_time);
 
 #endif
 
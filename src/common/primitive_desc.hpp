@@ -165,6 +165,14 @@ struct primitive_desc_t : public c_compatible {
                            .has_runtime_dims_or_strides();
     }
 
+    // Returns true if the implementation does not depend on the number of
+    // threads available at creation time and splits the work for the number
+    // of threads available at execution time (up to
+    // `get_primitive_max_threads()`). Such primitives are shared in the
+    // primitive cache regardless of the number of threads available, but not
+    // between different limits.
+    virtual bool is_nthr_adaptive() const { return false; }
+
     enum class arg_usage_t { unused, input, output };
     virtual arg_usage_t arg_usage(int arg) const {
         using types::is_zero_md;
@@ -117,6 +117,10 @@ const std::shared_ptr<primitive_desc_t> &dnnl_primitive_desc::impl() const {
     return pd_;
 }
 
+dnnl_primitive_desc *dnnl_primitive_desc::clone() const {
+    return new dnnl_primitive_desc(pd_, engine_);
+}
+
 dnnl::impl::engine_t *dnnl_primitive_desc::engine() const {
     return engine_;
 }
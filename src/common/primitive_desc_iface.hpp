@@ -76,6 +76,10 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
 
     const std::shared_ptr<dnnl::impl::primitive_desc_t> &impl() const;
 
+    // Returns a copy that shares the primitive descriptor implementation and
+    // doesn't support implementation iteration.
+    virtual dnnl_primitive_desc *clone() const;
+
 protected:
     std::unique_ptr<dnnl::impl::primitive_desc_iterator_t> pd_iterator_;
     // TODO: Extend iterator to support concat, sum and reorder primitives.
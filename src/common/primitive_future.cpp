@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
+#include "primitive_hashing.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Threading settings of the submitting thread. The number of threads is a
+// part of the primitive cache key and may affect the implementation, so the
+// worker threads adopt the settings of the thread that requested the
+// creation.
+struct thread_settings_t {
+    thread_settings_t() : max_threads_(dnnl_get_max_threads()) {}
+
+    void apply() const {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(max_threads_);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        threadpool_utils::get_threadlocal_max_concurrency() = max_threads_;
+#endif
+    }
+
+private:
+    int max_threads_;
+};
+
+// A pool of worker threads that create primitives. Workers are spawned on
+// demand up to the limit set by the ONEDNN_PRIMITIVE_CREATION_THREADS
+// environment variable, which defaults to the number of hardware threads.
+//
+// The pool is never destroyed and its workers are detached: joining them from
+// a static destructor may deadlock when the library is unloaded or when the
+// process exits from a worker. Instead, the pool is shut down at exit: idle
+// workers return and pending tasks are dropped.
+struct creation_pool_t {
+    static creation_pool_t &get() {
+        static creation_pool_t *pool = new creation_pool_t();
+        static shutdown_guard_t guard(pool);
+        return *pool;
+    }
+
+    // Returns false if the pool has been shut down.
+    bool submit(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) return false;
+        tasks_.push(std::move(task));
+        if (nidle_ == 0 && nworkers_ < max_workers_) {
+            std::thread(&creation_pool_t::worker, this).detach();
+            nworkers_++;
+        }
+        cv_.notify_one();
+        return true;
+    }
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+    }
+
+private:
+    struct shutdown_guard_t {
+        shutdown_guard_t(creation_pool_t *pool) : pool_(pool) {}
+        ~shutdown_guard_t() { pool_->shutdown(); }
+
+    private:
+        creation_pool_t *pool_;
+    };
+
+    creation_pool_t() {
+        const int nthr = getenv_int_user("PRIMITIVE_CREATION_THREADS", 0);
+        max_workers_ = nthr > 0
+                ? (size_t)nthr
+                : std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            nidle_++;
+            cv_.wait(lock, [&] { return stop_ || !tasks_.empty(); });
+            nidle_--;
+            if (stop_) return;
+
+            auto task = std::move(tasks_.front());
+            tasks_.pop();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::queue<std::function<void()>> tasks_;
+    size_t nworkers_ = 0;
+    size_t max_workers_ = 1;
+    size_t nidle_ = 0;
+    bool stop_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(creation_pool_t);
+};
+
+using result_t = primitive_future_t::result_t;
+
+// Creations that are in flight, keyed the same way as the primitive cache.
+// The keys refer to the primitive descriptors owned by the creation tasks, so
+// an entry is removed before its task is destroyed. Like the pool, the
+// registry is never destroyed as workers may still use it at exit.
+struct in_flight_creations_t {
+    static in_flight_creations_t &get() {
+        static in_flight_creations_t *creations = new in_flight_creations_t();
+        return *creations;
+    }
+
+    // Returns a valid future if the creation for the key is in flight,
+    // otherwise registers the passed future and returns an invalid one.
+    std::shared_future<result_t> get_or_add(
+            const primitive_hashing::key_t &key,
+            const std::shared_future<result_t> &future) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = creations_.find(key);
+        if (it != creations_.end()) return it->second;
+        creations_.emplace(key, future);
+        return std::shared_future<result_t>();
+    }
+
+    void remove(const primitive_hashing::key_t &key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        creations_.erase(key);
+    }
+
+private:
+    in_flight_creations_t() = default;
+
+    std::mutex mutex_;
+    std::unordered_map<primitive_hashing::key_t, std::shared_future<result_t>>
+            creations_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(in_flight_creations_t);
+};
+
+std::shared_future<result_t> submit_creation(
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    std::shared_ptr<primitive_desc_iface_t> pd_iface(
+            primitive_desc_iface->clone());
+    primitive_hashing::key_t key(
+            pd_iface->impl().get(), pd_iface->engine());
+
+    auto promise = std::make_shared<std::promise<result_t>>();
+    std::shared_future<result_t> future = promise->get_future().share();
+    auto in_flight = in_flight_creations_t::get().get_or_add(key, future);
+    if (in_flight.valid()) return in_flight;
+
+    thread_settings_t settings;
+    const bool submitted = creation_pool_t::get().submit([=]() {
+        settings.apply();
+
+        result_t result;
+        primitive_iface_t *primitive_iface = nullptr;
+        result.status
+                = dnnl_primitive_create(&primitive_iface, pd_iface.get());
+        if (result.status == success) {
+            result.primitive = std::shared_ptr<primitive_iface_t>(
+                    primitive_iface, [](primitive_iface_t *p) { p->release(); });
+        }
+        promise->set_value(result);
+        in_flight_creations_t::get().remove(key);
+    });
+    if (!submitted) {
+        result_t result;
+        result.status = runtime_error;
+        promise->set_value(result);
+        in_flight_creations_t::get().remove(key);
+    }
+    return future;
+}
+
+} // namespace
+
+status_t primitive_create_async(primitive_future_t **futures, int n,
+        const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (n < 0) return invalid_arguments;
+    if (n == 0) return success;
+    if (utils::any_null(futures, primitive_desc_ifaces))
+        return invalid_arguments;
+    for (int i = 0; i < n; i++)
+        if (!primitive_desc_ifaces[i]) return invalid_arguments;
+
+    for (int i = 0; i < n; i++)
+        futures[i] = new primitive_future_t(
+                submit_creation(primitive_desc_ifaces[i]));
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+bool dnnl_primitive_future::is_ready() const {
+    return future_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_future::get(primitive_iface_t **primitive_iface) const {
+    const result_t &result = future_.get();
+    if (result.status != success) return result.status;
+
+    result.primitive->retain();
+    *primitive_iface = result.primitive.get();
+    return success;
+}
+
+status_t dnnl_primitive_create_async(primitive_future_t **futures, int n,
+        const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    return primitive_create_async(futures, n, primitive_desc_ifaces);
+}
+
+status_t dnnl_primitive_future_is_ready(
+        const primitive_future_t *future, int *is_ready) {
+    if (utils::any_null(future, is_ready)) return invalid_arguments;
+    *is_ready = future->is_ready();
+    return success;
+}
+
+status_t dnnl_primitive_future_get(
+        primitive_iface_t **primitive_iface, const primitive_future_t *future) {
+    if (utils::any_null(primitive_iface, future)) return invalid_arguments;
+    return future->get(primitive_iface);
+}
+
+status_t dnnl_primitive_future_destroy(primitive_future_t *future) {
+    delete future;
+    return success;
+}
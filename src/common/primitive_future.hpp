@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_FUTURE_HPP
+#define COMMON_PRIMITIVE_FUTURE_HPP
+
+#include <future>
+#include <memory>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+// dnnl_primitive_future is a user facing entity that has an alias
+// primitive_future_t for internal use. It refers to the shared state of an
+// asynchronous primitive creation. Futures created for primitive descriptors
+// with the same primitive cache key may refer to the same shared state.
+struct dnnl_primitive_future : public dnnl::impl::c_compatible {
+    struct result_t {
+        std::shared_ptr<primitive_iface_t> primitive;
+        dnnl::impl::status_t status = dnnl::impl::status::success;
+    };
+
+    dnnl_primitive_future(const std::shared_future<result_t> &future)
+        : future_(future) {}
+
+    bool is_ready() const;
+
+    // Waits for the creation to complete and returns a new reference to the
+    // created primitive.
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface) const;
+
+private:
+    std::shared_future<result_t> future_;
+
+    dnnl_primitive_future() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_future);
+};
+
+namespace dnnl {
+namespace impl {
+
+status_t primitive_create_async(primitive_future_t **futures, int n,
+        const primitive_desc_iface_t *const *primitive_desc_ifaces);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -36,6 +36,7 @@ key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
     , attr_(attr)
     , pd_iterator_offset_(pd_iterator_offset)
     , impl_nthr_(dnnl_get_max_threads())
+    , max_nthr_(get_primitive_max_threads())
     , skip_idx_(skip_idx)
     , hint_mds_(hint_mds)
     , engine_id_(engine->engine_id())
@@ -43,7 +44,11 @@ key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
 
 key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
     : key_t(engine, pd->op_desc(), pd->attr(), pd->pd_iterator_offset(),
-              pd->hint_mds(false /* is_hint */), pd->skip_idx()) {}
+              pd->hint_mds(false /* is_hint */), pd->skip_idx()) {
+    // Thread-count adaptive primitives are valid for any number of threads
+    // available, but are blocked for the limit set at creation.
+    if (pd->is_nthr_adaptive()) impl_nthr_ = max_nthr_;
+}
 
 bool key_t::operator==(const key_t &rhs) const {
     DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
@@ -55,6 +60,7 @@ bool key_t::operator==(const key_t &rhs) const {
         && hint_mds_.size() == rhs.hint_mds_.size()
         && pd_iterator_offset_ == rhs.pd_iterator_offset_
         && impl_nthr_ == rhs.impl_nthr_
+        && max_nthr_ == rhs.max_nthr_
         && skip_idx_ == rhs.skip_idx_
         && (*attr_) == (*rhs.attr_)
         && std::equal(
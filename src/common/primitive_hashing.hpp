@@ -53,6 +53,7 @@ struct key_t {
     mutable const primitive_attr_t *attr_;
     int pd_iterator_offset_;
     int impl_nthr_;
+    int max_nthr_;
     int skip_idx_;
     std::vector<memory_desc_t> hint_mds_;
     engine_id_t engine_id_;
@@ -139,12 +140,14 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
         using namespace dnnl::impl;
         using namespace dnnl::impl::primitive_hashing;
         size_t seed = 0;
-        // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
+        // Compute hash for primitive_kind_, attr_, impl_id_, impl_nthr_ and
+        // max_nthr_
         seed = hash_combine(seed,
                 hash_combine(0, static_cast<size_t>(key.primitive_kind_)));
         seed = hash_combine(seed, get_attr_hash(*key.attr_));
         seed = hash_combine(seed, hash_combine(0, key.pd_iterator_offset_));
         seed = hash_combine(seed, hash_combine(0, key.impl_nthr_));
+        seed = hash_combine(seed, hash_combine(0, key.max_nthr_));
         seed = hash_combine(seed, hash_combine(0, key.skip_idx_));
 
         seed = hash_combine(seed, key.engine_id_.hash());
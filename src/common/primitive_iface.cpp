@@ -17,6 +17,7 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "command_list.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -31,6 +32,7 @@
 #include "profiler.hpp"
 #include "reorder_pd.hpp"
 #include "scratchpad_debug.hpp"
+#include "spin_wait.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
 #include "utils.hpp"
@@ -120,6 +122,9 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     auto stream = ctx.stream();
+    // Only dnnl_primitive_execute() records executions, other submissions
+    // would run out of the recorded order.
+    if (stream->is_recording()) return invalid_arguments;
     status_t status = success;
     auto pd = primitive_iface->pd();
 
@@ -157,11 +162,24 @@ status_t primitive_execute(
                                 ASYNCHRONOUS);
 #endif
         if (block_on_wait) stream->wait();
+        const bool with_barrier_stats = spin_wait::get_stats_enabled();
+        spin_wait::stats_t barrier_stats;
+        if (with_barrier_stats) barrier_stats = spin_wait::get_stats();
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         if (block_on_wait) stream->wait();
 
         double duration_ms = get_msec() - start_ms;
+        if (with_barrier_stats) {
+            // Counters are global, so concurrent executions are included.
+            const auto cur = spin_wait::get_stats();
+            verbose_printf(verbose_t::exec_profile,
+                    "primitive,exec,barrier,waits:%llu,parks:%llu,"
+                    "wait_time:%g\n",
+                    (unsigned long long)(cur.waits - barrier_stats.waits),
+                    (unsigned long long)(cur.parks - barrier_stats.parks),
+                    cur.wait_ms - barrier_stats.wait_ms);
+        }
         if (pd->impl()->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
@@ -243,6 +261,9 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             && IMPLICATION(nargs > 0, c_args != nullptr);
     if (!ok) return invalid_arguments;
 
+    if (stream->is_recording())
+        return stream->recording()->append(primitive_iface, nargs, c_args);
+
     exec_args_t args;
     status_t status = cvt_primitive_args(
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
@@ -365,6 +386,11 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
 }
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
+    return execute(ctx, scratchpad_memory_storage(ctx));
+}
+
+const memory_storage_t *dnnl_primitive::scratchpad_memory_storage(
+        const exec_ctx_t &ctx) const {
     const memory_storage_t *mem_storage = nullptr;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
@@ -373,7 +399,29 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
     }
+    return mem_storage;
+}
+
+status_t dnnl_primitive::create_deferred_scratchpad(
+        std::unique_ptr<scratchpad_t> &scratchpad) const {
+    scratchpad.reset();
+    if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user
+            || !scratchpad_ || !scratchpad_->is_global())
+        return status::success;
+
+    const size_t scratchpad_size
+            = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
+    scratchpad.reset(create_scratchpad(pd_->engine(), scratchpad_size,
+            /* use_global_scratchpad = */ false));
+    if (!scratchpad || !scratchpad->get_memory_storage()) {
+        scratchpad.reset();
+        return status::out_of_memory;
+    }
+    return status::success;
+}
 
+status_t dnnl_primitive::execute(
+        exec_ctx_t &ctx, const memory_storage_t *mem_storage) const {
     // Obtain a scratchpad memory storage host ptr from the context.
     // `require_host_ptr = true` guarantees a nullptr will be returned if the
     // usage model doesn't assume memory mapping.
@@ -392,6 +440,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     return status;
 }
 
+status_t dnnl_primitive::execute_bound(exec_ctx_t &ctx) const {
+    return primitive_->execute(ctx);
+}
+
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
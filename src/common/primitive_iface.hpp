@@ -66,6 +66,26 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    // Returns the scratchpad memory storage for an execution with `ctx`. The
+    // global scratchpad is thread-local, so the storage must be obtained on
+    // the thread that submits the execution.
+    const dnnl::impl::memory_storage_t *scratchpad_memory_storage(
+            const dnnl::impl::exec_ctx_t &ctx) const;
+    // Creates a scratchpad for an execution that runs after other primitives
+    // may have been created. The global scratchpad is reallocated when a
+    // primitive with a larger scratchpad is created, so such an execution
+    // gets a scratchpad of its own. `scratchpad` is left empty if the
+    // primitive doesn't use the global scratchpad.
+    dnnl::impl::status_t create_deferred_scratchpad(
+            std::unique_ptr<dnnl::impl::scratchpad_t> &scratchpad) const;
+    // Executes the primitive with the scratchpad storage obtained in advance
+    // with `scratchpad_memory_storage()`, possibly on another thread.
+    dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx,
+            const dnnl::impl::memory_storage_t *scratchpad_storage) const;
+    // Executes the primitive with the scratchpad grantor and the resource
+    // mapper bound to `ctx` by a previous execution of the same context.
+    dnnl::impl::status_t execute_bound(dnnl::impl::exec_ctx_t &ctx) const;
+
     void retain() { counter_++; }
 
     void release() {
@@ -60,6 +60,11 @@ struct reorder_primitive_desc_iface_t : public dnnl_primitive_desc {
         return scratchpad_engine_;
     }
 
+    dnnl_primitive_desc *clone() const override {
+        return new reorder_primitive_desc_iface_t(
+                pd_, engine_, src_engine_, dst_engine_);
+    }
+
     dnnl::impl::status_t query(
             dnnl::impl::query_t what, int idx, void *result) const override {
         auto status = dnnl::impl::status::success;
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #ifdef _WIN32
 #include <windows.h>
 #else
@@ -26,21 +30,14 @@ using namespace dnnl;
 using namespace dnnl::impl;
 using namespace dnnl::impl::utils;
 
-struct rw_mutex_t::rw_mutex_impl_t {
+namespace {
 #ifdef _WIN32
-    using rwlock_t = SRWLOCK;
+using rwlock_t = SRWLOCK;
 #else
-    using rwlock_t = pthread_rwlock_t;
+using rwlock_t = pthread_rwlock_t;
 #endif
-    rwlock_t &impl() { return impl_; }
-
-private:
-    rwlock_t impl_;
-};
 
-rw_mutex_t::rw_mutex_t() {
-    rw_mutex_impl_ = utils::make_unique<rw_mutex_impl_t>();
-    auto &impl = rw_mutex_impl_->impl();
+void rwlock_init(rwlock_t &impl) {
 #ifdef _WIN32
     InitializeSRWLock(&impl);
 #else
@@ -48,8 +45,7 @@ rw_mutex_t::rw_mutex_t() {
 #endif
 }
 
-void rw_mutex_t::lock_read() {
-    auto &impl = rw_mutex_impl_->impl();
+void rwlock_lock_read(rwlock_t &impl) {
 #ifdef _WIN32
     AcquireSRWLockShared(&impl);
 #else
@@ -57,8 +53,7 @@ void rw_mutex_t::lock_read() {
 #endif
 }
 
-void rw_mutex_t::lock_write() {
-    auto &impl = rw_mutex_impl_->impl();
+void rwlock_lock_write(rwlock_t &impl) {
 #ifdef _WIN32
     AcquireSRWLockExclusive(&impl);
 #else
@@ -66,8 +61,7 @@ void rw_mutex_t::lock_write() {
 #endif
 }
 
-void rw_mutex_t::unlock_read() {
-    auto &impl = rw_mutex_impl_->impl();
+void rwlock_unlock_read(rwlock_t &impl) {
 #ifdef _WIN32
     ReleaseSRWLockShared(&impl);
 #else
@@ -75,8 +69,7 @@ void rw_mutex_t::unlock_read() {
 #endif
 }
 
-void rw_mutex_t::unlock_write() {
-    auto &impl = rw_mutex_impl_->impl();
+void rwlock_unlock_write(rwlock_t &impl) {
 #ifdef _WIN32
     ReleaseSRWLockExclusive(&impl);
 #else
@@ -84,26 +77,126 @@ void rw_mutex_t::unlock_write() {
 #endif
 }
 
-rw_mutex_t::~rw_mutex_t() {
+void rwlock_destroy(rwlock_t &impl) {
 // SRW locks do not need to be explicitly destroyed
 #ifndef _WIN32
-    auto &impl = rw_mutex_impl_->impl();
     pthread_rwlock_destroy(&impl);
+#else
+    UNUSED(impl);
 #endif
 }
+} // namespace
+
+struct rw_mutex_t::rw_mutex_impl_t {
+    rwlock_t &impl() { return impl_; }
+
+private:
+    rwlock_t impl_;
+};
+
+rw_mutex_t::rw_mutex_t() {
+    rw_mutex_impl_ = utils::make_unique<rw_mutex_impl_t>();
+    rwlock_init(rw_mutex_impl_->impl());
+}
+
+void rw_mutex_t::lock_read() {
+    rwlock_lock_read(rw_mutex_impl_->impl());
+}
+
+void rw_mutex_t::lock_write() {
+    rwlock_lock_write(rw_mutex_impl_->impl());
+}
+
+void rw_mutex_t::unlock_read() {
+    rwlock_unlock_read(rw_mutex_impl_->impl());
+}
+
+void rw_mutex_t::unlock_write() {
+    rwlock_unlock_write(rw_mutex_impl_->impl());
+}
+
+rw_mutex_t::~rw_mutex_t() {
+    rwlock_destroy(rw_mutex_impl_->impl());
+}
+
+// The padding keeps the locks of the neighboring shards on different cache
+// lines regardless of the alignment of the array.
+struct sharded_rw_mutex_t::shard_t {
+    rwlock_t impl;
+    char padding[64];
+};
+
+sharded_rw_mutex_t::sharded_rw_mutex_t() {
+    // More shards than threads do not reduce the contention any further.
+    const int max_nshards = 64;
+    nshards_ = std::max(1,
+            std::min(max_nshards, (int)std::thread::hardware_concurrency()));
+    shards_.reset(new shard_t[nshards_]);
+    for (int i = 0; i < nshards_; i++)
+        rwlock_init(shards_[i].impl);
+}
+
+sharded_rw_mutex_t::shard_t &sharded_rw_mutex_t::get_shard() {
+    // The threads are assigned to the shards in the round-robin order once,
+    // so a thread always unlocks the same shard it has locked.
+    static std::atomic<unsigned> next_thread_idx {0};
+    thread_local static unsigned thread_idx = next_thread_idx++;
+    return shards_[thread_idx % (unsigned)nshards_];
+}
+
+void sharded_rw_mutex_t::lock_read() {
+    rwlock_lock_read(get_shard().impl);
+}
+
+void sharded_rw_mutex_t::lock_write() {
+    // The shards are always taken in the same order to avoid deadlocks
+    // between writers.
+    for (int i = 0; i < nshards_; i++)
+        rwlock_lock_write(shards_[i].impl);
+}
+
+void sharded_rw_mutex_t::unlock_read() {
+    rwlock_unlock_read(get_shard().impl);
+}
+
+void sharded_rw_mutex_t::unlock_write() {
+    for (int i = nshards_ - 1; i >= 0; i--)
+        rwlock_unlock_write(shards_[i].impl);
+}
+
+sharded_rw_mutex_t::~sharded_rw_mutex_t() {
+    for (int i = 0; i < nshards_; i++)
+        rwlock_destroy(shards_[i].impl);
+}
+
+lock_read_t::lock_read_t(rw_mutex_t &rw_mutex) : rw_mutex_(&rw_mutex) {
+    rw_mutex_->lock_read();
+}
+
+lock_read_t::lock_read_t(sharded_rw_mutex_t &rw_mutex)
+    : sharded_rw_mutex_(&rw_mutex) {
+    sharded_rw_mutex_->lock_read();
+}
 
-lock_read_t::lock_read_t(rw_mutex_t &rw_mutex) : rw_mutex_(rw_mutex) {
-    rw_mutex_.lock_read();
+lock_write_t::lock_write_t(rw_mutex_t &rw_mutex) : rw_mutex_(&rw_mutex) {
+    rw_mutex_->lock_write();
 }
 
-lock_write_t::lock_write_t(rw_mutex_t &rw_mutex) : rw_mutex_(rw_mutex) {
-    rw_mutex_.lock_write();
+lock_write_t::lock_write_t(sharded_rw_mutex_t &rw_mutex)
+    : sharded_rw_mutex_(&rw_mutex) {
+    sharded_rw_mutex_->lock_write();
 }
 
 lock_read_t::~lock_read_t() {
-    rw_mutex_.unlock_read();
+    if (rw_mutex_)
+        rw_mutex_->unlock_read();
+    else
+        sharded_rw_mutex_->unlock_read();
 }
 
 lock_write_t::~lock_write_t() {
-    rw_mutex_.unlock_write();
+    if (rw_mutex_)
+        rw_mutex_->unlock_write();
+    else
+        sharded_rw_mutex_->unlock_write();
 }
@@ -39,22 +39,48 @@ private:
     std::unique_ptr<rw_mutex_impl_t> rw_mutex_impl_;
 };
 
-struct lock_read_t {
+// A read-write lock for read-mostly data. The lock is split into shards that
+// reside on separate cache lines. A reader takes the shard assigned to the
+// calling thread only, so concurrent readers do not bounce a shared cache line
+// between cores. A writer takes all the shards, which makes writes more
+// expensive than with rw_mutex_t.
+struct DNNL_API sharded_rw_mutex_t {
+    sharded_rw_mutex_t();
+    void lock_read();
+    void lock_write();
+    void unlock_read();
+    void unlock_write();
+    ~sharded_rw_mutex_t();
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sharded_rw_mutex_t);
+
+private:
+    struct shard_t;
+    std::unique_ptr<shard_t[]> shards_;
+    int nshards_;
+
+    shard_t &get_shard();
+};
+
+struct DNNL_API lock_read_t {
     explicit lock_read_t(rw_mutex_t &rw_mutex);
+    explicit lock_read_t(sharded_rw_mutex_t &rw_mutex);
     ~lock_read_t();
     DNNL_DISALLOW_COPY_AND_ASSIGN(lock_read_t);
 
 private:
-    rw_mutex_t &rw_mutex_;
+    rw_mutex_t *rw_mutex_ = nullptr;
+    sharded_rw_mutex_t *sharded_rw_mutex_ = nullptr;
 };
 
-struct lock_write_t {
-    explicit lock_write_t(rw_mutex_t &rw_mutex_t);
+struct DNNL_API lock_write_t {
+    explicit lock_write_t(rw_mutex_t &rw_mutex);
+    explicit lock_write_t(sharded_rw_mutex_t &rw_mutex);
     ~lock_write_t();
     DNNL_DISALLOW_COPY_AND_ASSIGN(lock_write_t);
 
 private:
-    rw_mutex_t &rw_mutex_;
+    rw_mutex_t *rw_mutex_ = nullptr;
+    sharded_rw_mutex_t *sharded_rw_mutex_ = nullptr;
 };
 
 } // namespace utils
@@ -31,7 +31,7 @@ namespace impl {
 namespace {
 
 memory_storage_t *create_scratchpad_memory_storage(
-        engine_t *engine, size_t size) {
+        engine_t *engine, size_t size, void *handle = nullptr) {
     // XXX: if engine is a non-native CPU engine (read: SYCL) then create
     // scratchpad through other, native CPU engine.
     //
@@ -53,7 +53,10 @@ memory_storage_t *create_scratchpad_memory_storage(
 #endif
 
     memory_storage_t *mem_storage = nullptr;
-    auto status = mem_engine->create_memory_storage(&mem_storage, size);
+    const unsigned flags = handle ? memory_flags_t::use_runtime_ptr
+                                  : memory_flags_t::alloc;
+    auto status = mem_engine->create_memory_storage(
+            &mem_storage, flags, size, handle);
     MAYBE_UNUSED(status);
     return mem_storage;
 }
@@ -94,26 +97,25 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
         if (size > size_) {
-            delete mem_storage_;
-            // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
-            if (mem_storage_ == nullptr) {
-                // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
-                if (mem_storage_ == nullptr) size_ = 0;
-            } else
-                size_ = size;
+            const size_t old_size = size_;
+            release();
+            // Try to expand the global scratchpad to the necessary size. With
+            // huge pages the capacity grows geometrically to avoid frequent
+            // reallocations of the pages.
+            const size_t new_size = huge_pages_enabled()
+                    ? nstl::max(size, 2 * old_size)
+                    : size;
+            bool ok = allocate(engine, new_size);
+            if (!ok && new_size != size) ok = allocate(engine, size);
+            // Recreate scratchpad with original capacity
+            if (!ok) allocate(engine, old_size);
         }
         reference_count_++;
     }
 
     ~global_scratchpad_t() override {
         reference_count_--;
-        if (reference_count_ == 0) {
-            delete mem_storage_;
-            mem_storage_ = nullptr;
-            size_ = 0;
-        }
+        if (reference_count_ == 0) release();
     }
 
     const memory_storage_t *get_memory_storage() const override {
@@ -122,9 +124,45 @@ struct global_scratchpad_t : public scratchpad_t {
 
     size_t size() const override { return size_; }
 
+    bool is_global() const override { return true; }
+
 private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(global_scratchpad_t);
+
+    static bool huge_pages_enabled() { return get_huge_page_size() > 0; }
+
+    // Sets the scratchpad to a new memory storage with a capacity of at least
+    // `size` bytes. Huge pages are used if requested and available.
+    static bool allocate(engine_t *engine, size_t size) {
+        if (huge_pages_enabled()) {
+            size_t capacity = size;
+            void *ptr = huge_pages_malloc(capacity);
+            if (ptr) {
+                mem_storage_ = create_scratchpad_memory_storage(
+                        engine, capacity, ptr);
+                if (mem_storage_) {
+                    huge_pages_ = ptr;
+                    size_ = capacity;
+                    return true;
+                }
+                huge_pages_free(ptr, capacity);
+            }
+        }
+        mem_storage_ = create_scratchpad_memory_storage(engine, size);
+        size_ = mem_storage_ ? size : 0;
+        return mem_storage_ != nullptr;
+    }
+
+    static void release() {
+        delete mem_storage_;
+        mem_storage_ = nullptr;
+        huge_pages_free(huge_pages_, size_);
+        huge_pages_ = nullptr;
+        size_ = 0;
+    }
+
     thread_local static memory_storage_t *mem_storage_;
+    thread_local static void *huge_pages_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
 };
@@ -135,6 +173,7 @@ private:
 // before all its users are destroyed thus causing a crash at exit.
 // Tested by tests/gtests/test_global_scratchad.cpp
 thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
+thread_local void *global_scratchpad_t::huge_pages_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
@@ -28,6 +28,9 @@ struct scratchpad_t {
     virtual ~scratchpad_t() = default;
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+    // Returns true if the storage is shared by the primitives of the thread
+    // and may be reallocated when another primitive is created.
+    virtual bool is_global() const { return false; }
 };
 
 scratchpad_t *create_scratchpad(
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <algorithm>
+#include <cstring>
+
+#include "common/sha256.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+const uint32_t round_constants[64] = {0x428a2f98, 0x71374491, 0xb5c0fbcf,
+        0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98,
+        0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7,
+        0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+        0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8,
+        0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85,
+        0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e,
+        0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819,
+        0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c,
+        0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee,
+        0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+        0xc67178f2};
+
+inline uint32_t rotr(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+} // namespace
+
+sha256_t::sha256_t()
+    : state_ {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f,
+            0x9b05688c, 0x1f83d9ab, 0x5be0cd19} {}
+
+void sha256_t::process_block(const uint8_t *block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16
+                | (uint32_t)block[4 * i + 2] << 8 | (uint32_t)block[4 * i + 3];
+    for (int i = 16; i < 64; i++) {
+        const uint32_t s0
+                = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1
+                = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3],
+             e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+    for (int i = 0; i < 64; i++) {
+        const uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+        const uint32_t ch = (e & f) ^ (~e & g);
+        const uint32_t t1 = h + s1 + ch + round_constants[i] + w[i];
+        const uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+        const uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+}
+
+void sha256_t::update(const void *data, size_t size) {
+    const auto *p = static_cast<const uint8_t *>(data);
+    total_size_ += size;
+    if (buffer_size_ > 0) {
+        const size_t n = std::min(size, sizeof(buffer_) - buffer_size_);
+        std::memcpy(buffer_ + buffer_size_, p, n);
+        buffer_size_ += n;
+        p += n;
+        size -= n;
+        if (buffer_size_ < sizeof(buffer_)) return;
+        process_block(buffer_);
+        buffer_size_ = 0;
+    }
+    for (; size >= sizeof(buffer_); size -= sizeof(buffer_)) {
+        process_block(p);
+        p += sizeof(buffer_);
+    }
+    std::memcpy(buffer_, p, size);
+    buffer_size_ = size;
+}
+
+sha256_t::digest_t sha256_t::finalize() {
+    // The message is padded with a single one bit, zeros, and the message
+    // length in bits, so that the length becomes a multiple of the block.
+    const uint64_t size_in_bits = total_size_ * 8;
+    const uint8_t one = 0x80, zero = 0;
+    update(&one, 1);
+    while (buffer_size_ != sizeof(buffer_) - sizeof(size_in_bits))
+        update(&zero, 1);
+    uint8_t size_bytes[8];
+    for (int i = 0; i < 8; i++)
+        size_bytes[i] = (uint8_t)(size_in_bits >> (56 - 8 * i));
+    update(size_bytes, sizeof(size_bytes));
+
+    digest_t digest;
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 4; j++)
+            digest[4 * i + j] = (uint8_t)(state_[i] >> (24 - 8 * j));
+    return digest;
+}
+
+std::string sha256_t::to_hex(const digest_t &digest) {
+    static const char digits[] = "0123456789abcdef";
+    std::string s;
+    s.reserve(2 * digest.size());
+    for (uint8_t b : digest) {
+        s.push_back(digits[b >> 4]);
+        s.push_back(digits[b & 0xf]);
+    }
+    return s;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef COMMON_SHA256_HPP
+#define COMMON_SHA256_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+
+// SHA-256 message digest (FIPS 180-4). Used where a 64-bit hash is not enough
+// to tell the data apart, e.g. to identify content shared between processes.
+struct DNNL_API sha256_t {
+    using digest_t = std::array<uint8_t, 32>;
+
+    sha256_t();
+
+    void update(const void *data, size_t size);
+    void update(const std::string &s) { update(s.data(), s.size()); }
+
+    // Completes the digest. The object must not be updated afterwards.
+    digest_t finalize();
+
+    // Returns the digest as a string of lowercase hexadecimal digits.
+    static std::string to_hex(const digest_t &digest);
+
+private:
+    void process_block(const uint8_t *block);
+
+    uint32_t state_[8];
+    uint8_t buffer_[64];
+    size_t buffer_size_ = 0;
+    uint64_t total_size_ = 0;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/spin_wait.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace spin_wait {
+
+namespace {
+std::atomic<int> &spin_count_value() {
+    static std::atomic<int> spin_count {
+            getenv_int_user("BARRIER_SPIN_COUNT", -1)};
+    return spin_count;
+}
+} // namespace
+
+int get_spin_count() {
+    return spin_count_value().load(std::memory_order_relaxed);
+}
+
+void set_spin_count(int spin_count) {
+    spin_count_value().store(spin_count, std::memory_order_relaxed);
+}
+
+bool get_stats_enabled() {
+    static const bool enabled = getenv_int_user("BARRIER_STATS", 0) != 0;
+    return enabled;
+}
+
+namespace {
+std::atomic<uint64_t> stats_waits {0};
+std::atomic<uint64_t> stats_parks {0};
+std::atomic<uint64_t> stats_wait_ns {0};
+} // namespace
+
+stats_t get_stats() {
+    stats_t s;
+    s.waits = stats_waits.load(std::memory_order_relaxed);
+    s.parks = stats_parks.load(std::memory_order_relaxed);
+    s.wait_ms = stats_wait_ns.load(std::memory_order_relaxed) / 1e6;
+    return s;
+}
+
+void record_wait(double wait_ms, bool parked) {
+    stats_waits.fetch_add(1, std::memory_order_relaxed);
+    if (parked) stats_parks.fetch_add(1, std::memory_order_relaxed);
+    stats_wait_ns.fetch_add(
+            static_cast<uint64_t>(wait_ms * 1e6), std::memory_order_relaxed);
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+void park(const volatile uint32_t *addr, uint32_t val) {
+#ifdef __linux__
+    // The return value is ignored: EAGAIN means that the value has already
+    // changed, and EINTR is a spurious wake-up the caller handles.
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, nullptr, nullptr, 0);
+#else
+    UNUSED(addr);
+    UNUSED(val);
+    std::this_thread::yield();
+#endif
+}
+
+void unpark_all(const volatile uint32_t *addr) {
+#ifdef __linux__
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr,
+            0);
+#else
+    UNUSED(addr);
+#endif
+}
+
+} // namespace spin_wait
+} // namespace impl
+} // namespace dnnl
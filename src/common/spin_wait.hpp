@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SPIN_WAIT_HPP
+#define COMMON_SPIN_WAIT_HPP
+
+#include <cstdint>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace spin_wait {
+
+// Returns the number of spin iterations a thread waiting on a barrier
+// performs before it parks (ONEDNN_BARRIER_SPIN_COUNT). A negative value
+// means that the barrier uses its default policy: pure spinning for
+// simple_barrier and immediate parking for counting_barrier_t.
+int DNNL_API get_spin_count();
+
+// Overrides the spin count taken from the environment. Intended for testing.
+void DNNL_API set_spin_count(int spin_count);
+
+// Barrier wait telemetry is collected when ONEDNN_BARRIER_STATS is set.
+struct stats_t {
+    uint64_t waits = 0; // number of waits that were not the last arrival
+    uint64_t parks = 0; // number of waits that ended up parked
+    double wait_ms = 0; // total wait time
+};
+
+bool DNNL_API get_stats_enabled();
+stats_t get_stats();
+void DNNL_API record_wait(double wait_ms, bool parked);
+
+// Returns a timestamp in milliseconds for wait time measurements.
+double DNNL_API now_ms();
+
+// Blocks the calling thread while `*addr == val`. May return spuriously, so
+// the caller re-checks the condition. Falls back to yielding the time slice
+// when the OS does not provide futexes.
+void park(const volatile uint32_t *addr, uint32_t val);
+
+// Wakes up all threads parked on `addr`.
+void unpark_all(const volatile uint32_t *addr);
+
+} // namespace spin_wait
+} // namespace impl
+} // namespace dnnl
+
+#endif
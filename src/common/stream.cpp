@@ -20,10 +20,13 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "command_list.hpp"
 #include "engine.hpp"
 #include "primitive_exec_types.hpp"
+#include "prepared_primitive.hpp"
 #include "primitive_iface.hpp"
 #include "stream.hpp"
+#include "stream_attr.hpp"
 #include "utils.hpp"
 
 #include "common/stream_impl.hpp"
@@ -32,11 +35,29 @@ using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
 
+dnnl_stream::dnnl_stream(engine_t *engine, stream_impl_t *impl)
+    : engine_(engine), impl_(impl) {}
+
+dnnl_stream::~dnnl_stream() = default;
+
 status_t stream_t::enqueue_primitive(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     return primitive_iface->execute(ctx);
 }
 
+status_t dnnl_stream::begin_recording() {
+    if (recording_) return invalid_arguments;
+    if (!is_prepared_execution_supported(this)) return unimplemented;
+    recording_.reset(new command_list_t(this));
+    return success;
+}
+
+status_t dnnl_stream::end_recording(command_list_t **command_list) {
+    if (!recording_) return invalid_arguments;
+    *command_list = recording_.release();
+    return success;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
@@ -48,10 +69,76 @@ status_t dnnl_stream_create(
             && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
+    if (engine->kind() != engine_kind::cpu
+            && (flags & stream_flags::numa_aware)) {
+        return status::unimplemented;
+    }
 
     return engine->create_stream(stream, flags);
 }
 
+status_t dnnl_stream_create_v2(stream_t **stream, engine_t *engine,
+        unsigned flags, const stream_attr_t *attr) {
+    if (any_null(stream, engine)) return invalid_arguments;
+    if (!attr || attr->has_default_values())
+        return dnnl_stream_create(stream, engine, flags);
+
+    // Threads of parallel regions are controlled for the OpenMP runtime only,
+    // other runtimes should rely on the threadpool interoperability API.
+    if (engine->kind() != engine_kind::cpu) return unimplemented;
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP
+    return unimplemented;
+#endif
+#ifndef __linux__
+    if (!attr->cpu_mask_.empty()) return unimplemented;
+#endif
+
+    CHECK(dnnl_stream_create(stream, engine, flags));
+    (*stream)->impl()->set_thread_attr(attr->nthr_, attr->cpu_mask_);
+    return success;
+}
+
+status_t dnnl_stream_attr_create(stream_attr_t **attr) {
+    if (any_null(attr)) return invalid_arguments;
+    return safe_ptr_assign(*attr, new stream_attr_t());
+}
+
+status_t dnnl_stream_attr_destroy(stream_attr_t *attr) {
+    delete attr;
+    return success;
+}
+
+status_t dnnl_stream_attr_set_num_threads(stream_attr_t *attr, int nthr) {
+    if (any_null(attr) || nthr < 0) return invalid_arguments;
+    attr->nthr_ = nthr;
+    return success;
+}
+
+status_t dnnl_stream_attr_get_num_threads(
+        const stream_attr_t *attr, int *nthr) {
+    if (any_null(attr, nthr)) return invalid_arguments;
+    *nthr = attr->nthr_;
+    return success;
+}
+
+status_t dnnl_stream_attr_set_cpu_mask(
+        stream_attr_t *attr, int ncpus, const int *cpus) {
+    if (any_null(attr) || ncpus < 0 || (ncpus > 0 && !cpus))
+        return invalid_arguments;
+    for (int i = 0; i < ncpus; i++)
+        if (cpus[i] < 0) return invalid_arguments;
+    attr->cpu_mask_.assign(cpus, cpus + ncpus);
+    return success;
+}
+
+status_t dnnl_stream_attr_get_cpu_mask(
+        const stream_attr_t *attr, int *ncpus, const int **cpus) {
+    if (any_null(attr, ncpus, cpus)) return invalid_arguments;
+    *ncpus = static_cast<int>(attr->cpu_mask_.size());
+    *cpus = attr->cpu_mask_.data();
+    return success;
+}
+
 status_t dnnl_stream_get_engine(const stream_t *stream, engine_t **engine) {
     if (any_null(stream, engine)) return invalid_arguments;
     *engine = stream->engine();
@@ -70,4 +157,15 @@ status_t dnnl_stream_destroy(stream_t *stream) {
     return success;
 }
 
+status_t dnnl_stream_begin_recording(stream_t *stream) {
+    if (stream == nullptr) return invalid_arguments;
+    return stream->begin_recording();
+}
+
+status_t dnnl_stream_end_recording(
+        stream_t *stream, command_list_t **command_list) {
+    if (utils::any_null(stream, command_list)) return invalid_arguments;
+    return stream->end_recording(command_list);
+}
+
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
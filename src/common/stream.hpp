@@ -27,9 +27,9 @@
 #include "common/utils.hpp"
 
 struct dnnl_stream : public dnnl::impl::c_compatible {
-    dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
-        : engine_(engine), impl_(impl) {}
-    virtual ~dnnl_stream() = default;
+    // Defined out of line, where command_list_t is complete.
+    dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl);
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -78,6 +78,14 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     dnnl::impl::stream_impl_t *impl() const { return impl_.get(); }
 
+    // While a stream is recording, primitive executions submitted to it are
+    // appended to a command list instead of being executed. Other
+    // submissions to a recording stream are rejected.
+    bool is_recording() const { return bool(recording_); }
+    command_list_t *recording() const { return recording_.get(); }
+    dnnl::impl::status_t begin_recording();
+    dnnl::impl::status_t end_recording(command_list_t **command_list);
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -91,6 +99,7 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    std::unique_ptr<command_list_t> recording_;
 };
 
 #endif
@@ -0,0 +1,36 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_ATTR_HPP
+#define COMMON_STREAM_ATTR_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+struct dnnl_stream_attr : public dnnl::impl::c_compatible {
+    dnnl_stream_attr() = default;
+
+    bool has_default_values() const { return nthr_ == 0 && cpu_mask_.empty(); }
+
+    // Number of threads of parallel regions, 0 means the runtime default.
+    int nthr_ = 0;
+    // Logical CPUs the threads of parallel regions are bound to.
+    std::vector<int> cpu_mask_;
+};
+
+#endif
@@ -17,6 +17,8 @@
 #ifndef COMMON_STREAM_IMPL_HPP
 #define COMMON_STREAM_IMPL_HPP
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
 #include "common/c_types_map.hpp"
@@ -30,8 +32,9 @@ public:
     stream_impl_t() = delete;
     stream_impl_t(unsigned flags) : flags_(flags) {}
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
-    stream_impl_t(threadpool_interop::threadpool_iface *threadpool)
-        : flags_(stream_flags::in_order), threadpool_(threadpool) {}
+    stream_impl_t(threadpool_interop::threadpool_iface *threadpool,
+            unsigned flags = stream_flags::in_order)
+        : flags_(flags), threadpool_(threadpool) {}
 #endif
 
     virtual ~stream_impl_t() = default;
@@ -42,6 +45,15 @@ public:
         return (flags() & dnnl::impl::stream_flags::profiling);
     }
 
+    // Number of threads and CPU mask for parallel regions of CPU primitives,
+    // set from stream attributes.
+    void set_thread_attr(int nthr, const std::vector<int> &cpu_mask) {
+        nthr_ = nthr;
+        cpu_mask_ = cpu_mask;
+    }
+    int num_threads() const { return nthr_; }
+    const std::vector<int> &cpu_mask() const { return cpu_mask_; }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     status_t get_threadpool(
             threadpool_interop::threadpool_iface **threadpool) const {
@@ -54,6 +66,8 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(stream_impl_t)
 
     unsigned flags_;
+    int nthr_ = 0;
+    std::vector<int> cpu_mask_;
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     threadpool_interop::threadpool_iface *threadpool_ = nullptr;
 #endif
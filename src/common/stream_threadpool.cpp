@@ -36,14 +36,27 @@ using namespace dnnl::impl::utils;
 
 dnnl_status_t dnnl_threadpool_interop_stream_create(
         stream_t **stream, engine_t *engine, void *threadpool) {
+    return dnnl_threadpool_interop_stream_create_v2(
+            stream, engine, threadpool, stream_flags::in_order);
+}
+
+dnnl_status_t dnnl_threadpool_interop_stream_create_v2(
+        stream_t **stream, engine_t *engine, void *threadpool, unsigned flags) {
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
+    // Exactly one of the ordering flags is expected.
+    const unsigned order_flags
+            = stream_flags::in_order | stream_flags::out_of_order;
+    if (utils::one_of(flags & order_flags, 0u, order_flags)
+            || (flags & ~(order_flags | stream_flags::numa_aware)))
+        return invalid_arguments;
+
     auto tp = static_cast<dnnl::threadpool_interop::threadpool_iface *>(
             threadpool);
 
     std::unique_ptr<dnnl::impl::stream_impl_t> stream_impl(
-            new dnnl::impl::stream_impl_t(tp));
+            new dnnl::impl::stream_impl_t(tp, flags));
     if (!stream_impl) return status::out_of_memory;
 
     CHECK(engine->create_stream(stream, stream_impl.get()));
@@ -29,6 +29,11 @@
 #include <sys/types.h>
 #endif
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
 #include <algorithm>
 #include <climits>
 #include <cstdio>
@@ -186,6 +191,184 @@ int getpagesize() {
 #endif
 }
 
+size_t get_huge_page_size() {
+#if defined(__linux__)
+    static const size_t huge_page_size = []() -> size_t {
+        switch (getenv_int_user("HUGE_PAGES", 0)) {
+            case 1: return size_t(2) << 20;
+            case 2: return size_t(1) << 30;
+            default: return 0;
+        }
+    }();
+    return huge_page_size;
+#else
+    return 0;
+#endif
+}
+
+void *huge_pages_malloc(size_t &size) {
+    const size_t huge_page_size = get_huge_page_size();
+    if (huge_page_size == 0 || size == 0) return nullptr;
+
+#if defined(__linux__)
+    size = utils::rnd_up(size, huge_page_size);
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    // Explicit huge pages are used if the system has reserved them.
+    const int huge_page_shift = 26; // MAP_HUGE_SHIFT
+    const int log2_huge_page_size = huge_page_size == (size_t(1) << 30) ? 30
+                                                                        : 21;
+    void *p = mmap(nullptr, size, prot,
+            flags | MAP_HUGETLB | (log2_huge_page_size << huge_page_shift), -1,
+            0);
+    if (p != MAP_FAILED) return p;
+
+    // Otherwise transparent huge pages are requested for a region aligned to
+    // the huge page size. The system uses 2MB pages for them.
+    const size_t alignment = size_t(2) << 20;
+    p = mmap(nullptr, size + alignment, prot, flags, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+    char *base = static_cast<char *>(p);
+    char *aligned = reinterpret_cast<char *>(
+            utils::rnd_up(reinterpret_cast<size_t>(base), alignment));
+    if (aligned != base) munmap(base, aligned - base);
+    munmap(aligned + size, base + alignment - aligned);
+    madvise(aligned, size, MADV_HUGEPAGE);
+    return aligned;
+#else
+    return nullptr;
+#endif
+}
+
+void huge_pages_free(void *p, size_t size) {
+#if defined(__linux__)
+    if (p) munmap(p, size);
+#else
+    UNUSED(p);
+    UNUSED(size);
+#endif
+}
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+namespace {
+// Maps `size` bytes of `fd` at an address aligned to `alignment`.
+void *mmap_aligned(size_t size, size_t alignment, int prot, int fd) {
+    void *p = mmap(nullptr, size + alignment, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+    char *base = static_cast<char *>(p);
+    char *aligned = reinterpret_cast<char *>(
+            utils::rnd_up(reinterpret_cast<size_t>(base), alignment));
+    if (mmap(aligned, size, prot, MAP_SHARED | MAP_FIXED, fd, 0)
+            == MAP_FAILED) {
+        munmap(base, size + alignment);
+        return nullptr;
+    }
+    if (aligned != base) munmap(base, aligned - base);
+    munmap(aligned + size, base + alignment - aligned);
+    return aligned;
+}
+
+// Returns whether transparent huge pages may back shared memory, which code
+// pages are mapped from. MADV_HUGEPAGE has no effect on it otherwise.
+bool is_shmem_thp_enabled() {
+    static const bool enabled = []() {
+        FILE *fp = fopen(
+                "/sys/kernel/mm/transparent_hugepage/shmem_enabled", "r");
+        if (!fp) return false;
+        char buf[128] = {};
+        const bool read = fgets(buf, sizeof(buf), fp) != nullptr;
+        fclose(fp);
+        if (!read) return false;
+
+        // The active mode is bracketed, e.g. "always within_size [advise]".
+        const char *begin = std::strchr(buf, '[');
+        const char *end = begin ? std::strchr(begin, ']') : nullptr;
+        if (!end) return false;
+        const std::string mode(begin + 1, end);
+        return mode == "always" || mode == "within_size" || mode == "advise"
+                || mode == "force";
+    }();
+    return enabled;
+}
+} // namespace
+#endif
+
+void *code_pages_malloc(size_t &size, size_t page_size, void **writable) {
+    *writable = nullptr;
+    if (size == 0 || page_size == 0) return nullptr;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+    const size_t system_page_size = (size_t)getpagesize();
+    page_size = std::max(page_size, system_page_size);
+    size = utils::rnd_up(size, page_size);
+
+    const unsigned mfd_cloexec = 0x1U; // MFD_CLOEXEC
+    const unsigned mfd_hugetlb = 0x4U; // MFD_HUGETLB
+    const unsigned huge_page_shift = 26; // MFD_HUGE_SHIFT
+    const unsigned log2_huge_page_size
+            = page_size == (size_t(1) << 30) ? 30 : 21;
+    const bool huge = page_size > system_page_size;
+
+    // Explicit huge pages are tried first, then shared memory with
+    // transparent huge pages requested. The system uses 2MB pages for them.
+    for (const bool explicit_huge : {true, false}) {
+        if (explicit_huge && !huge) continue;
+        const bool thp = huge && !explicit_huge && is_shmem_thp_enabled();
+        if (huge && !explicit_huge && !thp)
+            VWARN(common, code_pages,
+                    "explicit huge pages are not available and transparent "
+                    "huge pages are disabled for shared memory, using %zu "
+                    "byte pages",
+                    system_page_size);
+        const unsigned flags = explicit_huge
+                ? mfd_cloexec | mfd_hugetlb
+                        | (log2_huge_page_size << huge_page_shift)
+                : mfd_cloexec;
+        const int fd = (int)syscall(SYS_memfd_create, "dnnl_jit_code", flags);
+        if (fd < 0) continue;
+
+        const size_t alignment = explicit_huge
+                ? page_size
+                : (thp ? size_t(2) << 20 : system_page_size);
+        void *code = nullptr, *data = nullptr;
+        if (ftruncate(fd, (off_t)size) == 0) {
+            code = mmap_aligned(size, alignment, PROT_READ | PROT_EXEC, fd);
+            if (code)
+                data = mmap_aligned(
+                        size, alignment, PROT_READ | PROT_WRITE, fd);
+        }
+        close(fd);
+        if (!data) {
+            if (code) munmap(code, size);
+            continue;
+        }
+
+        if (thp) {
+            madvise(code, size, MADV_HUGEPAGE);
+            madvise(data, size, MADV_HUGEPAGE);
+        }
+        *writable = data;
+        return code;
+    }
+    return nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+void code_pages_free(void *p, void *writable, size_t size) {
+#if defined(__linux__)
+    if (p) munmap(p, size);
+    if (writable) munmap(writable, size);
+#else
+    UNUSED(p);
+    UNUSED(writable);
+    UNUSED(size);
+#endif
+}
+
 void *malloc(size_t size, int alignment) {
     void *ptr;
     if (memory_debug::is_mem_debug())
@@ -230,6 +413,17 @@ bool get_jit_dump() {
     return jit_dump.get();
 }
 
+static setting_t<int> primitive_max_threads {0};
+int get_primitive_max_threads() {
+    if (!primitive_max_threads.initialized()) {
+        static int val = std::max(0,
+                getenv_int_user(
+                        "PRIMITIVE_MAX_THREADS", primitive_max_threads.get()));
+        primitive_max_threads.set(val);
+    }
+    return primitive_max_threads.get();
+}
+
 #if defined(DNNL_AARCH64) && (DNNL_AARCH64 == 1)
 static setting_t<unsigned> jit_profiling_flags {DNNL_JIT_PROFILE_LINUX_PERFMAP};
 #else
@@ -249,6 +443,15 @@ unsigned get_jit_profiling_flags() {
     return flag;
 }
 
+static thread_local size_t jit_code_footprint = 0;
+size_t get_jit_code_footprint() {
+    return jit_code_footprint;
+}
+
+void add_jit_code_footprint(size_t size) {
+    jit_code_footprint += size;
+}
+
 static setting_t<std::string> jit_profiling_jitdumpdir;
 dnnl_status_t init_jit_profiling_jitdumpdir(
         const char *jitdumpdir, bool overwrite) {
@@ -354,6 +557,20 @@ dnnl_status_t dnnl_set_jit_dump(int enabled) {
     return status::success;
 }
 
+dnnl_status_t dnnl_get_primitive_max_threads(int *nthr) {
+    using namespace dnnl::impl;
+    if (nthr == nullptr) return status::invalid_arguments;
+    *nthr = get_primitive_max_threads();
+    return status::success;
+}
+
+dnnl_status_t dnnl_set_primitive_max_threads(int nthr) {
+    using namespace dnnl::impl;
+    if (nthr < 0) return status::invalid_arguments;
+    primitive_max_threads.set(nthr);
+    return status::success;
+}
+
 dnnl_status_t dnnl_set_jit_profiling_flags(unsigned flags) {
     using namespace dnnl::impl;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -767,11 +767,35 @@ private:
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+// Maximum number of threads thread-count adaptive primitives are created for,
+// 0 if such primitives are disabled.
+int get_primitive_max_threads();
+// Number of bytes of JIT code generated by the calling thread. Caches use the
+// difference of two values to estimate the footprint of created objects.
+size_t get_jit_code_footprint();
+void add_jit_code_footprint(size_t size);
 // Checks if the filepath is a valid path and not a symlink to ensure
 // the application only processes secure files.
 status_t check_for_symlinks(const char *filename, bool *res);
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
+// Returns the size of huge pages requested with ONEDNN_HUGE_PAGES or 0 if
+// huge pages are not requested or not supported.
+size_t get_huge_page_size();
+// Allocates memory backed by huge pages. The size is rounded up to the huge
+// page size and the rounded value is returned in `size`. Returns nullptr if
+// huge pages are not requested or cannot be allocated.
+void *huge_pages_malloc(size_t &size);
+void huge_pages_free(void *p, size_t size);
+// Maps the same memory twice: as read-execute memory, which is returned, and
+// as read-write memory, which is returned in `writable`. Code is written
+// through the writable alias, so no page is ever writable and executable. The
+// memory is backed by pages of `page_size`, huge pages are used when it is
+// larger than the system page size. The size is rounded up to the page size
+// and the rounded value is returned in `size`. Returns nullptr if the memory
+// cannot be mapped.
+void *code_pages_malloc(size_t &size, size_t page_size, void **writable);
+void code_pages_free(void *p, void *writable, size_t size);
 
 // return current library fpmath_mode
 fpmath_mode_t get_fpmath_mode();
@@ -26,6 +26,7 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/sdpa_types.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -51,8 +52,12 @@
 
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
 #define CPU_INSTANCE_GROUPED(...) CPU_INSTANCE(__VA_ARGS__)
+#define CPU_INSTANCE_GROUPED_AVX2(...) CPU_INSTANCE_AVX2(__VA_ARGS__)
+#define CPU_INSTANCE_GROUPED_AVX512(...) CPU_INSTANCE_AVX512(__VA_ARGS__)
 #else
 #define CPU_INSTANCE_GROUPED(...)
+#define CPU_INSTANCE_GROUPED_AVX2(...)
+#define CPU_INSTANCE_GROUPED_AVX512(...)
 #endif
 
 namespace dnnl {
@@ -67,6 +72,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(gated_mlp);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -77,6 +83,7 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
 
@@ -103,6 +110,7 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gated_mlp);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -113,10 +121,9 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
-            case primitive_kind::gated_mlp: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -154,6 +161,13 @@ public:
         return cpu_engine_impl_list_t::get_implementation_list(desc);
     }
 
+    status_t serialize_device(serialization_stream_t &sstream) const override {
+        // Generated code depends on the ISA the library dispatches to.
+        sstream.append(platform::get_effective_cpu_isa());
+        sstream.append(platform::get_cpu_isa_hints());
+        return status::success;
+    }
+
 protected:
     ~cpu_engine_t() override = default;
 };
@@ -165,6 +179,7 @@ public:
         assert(index == 0);
         *engine = new cpu_engine_t(new impl::engine_impl_t(
                 engine_kind::cpu, get_cpu_native_runtime(), 0));
+        platform::init_thread_core_weights();
 
 #if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
         dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
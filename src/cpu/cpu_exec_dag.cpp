@@ -0,0 +1,282 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/scratchpad.hpp"
+
+#include "cpu/cpu_exec_dag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// Set while the calling thread runs iterations of a `parallel()` call of an
+// execution in the graph. Nested `parallel()` calls run sequentially then.
+thread_local bool in_parallel_for = false;
+
+struct region_t {
+    const char *begin;
+    const char *end;
+    bool is_write;
+};
+
+bool conflict(const region_t &a, const region_t &b) {
+    return (a.is_write || b.is_write) && a.begin < b.end && b.begin < a.end;
+}
+} // namespace
+
+struct exec_dag_t::node_t {
+    node_t(const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx)
+        : primitive_iface_(const_cast<primitive_iface_t *>(primitive_iface))
+        , ctx_(ctx)
+        , scratchpad_storage_(nullptr) {
+        primitive_iface_->retain();
+    }
+
+    ~node_t() { primitive_iface_->release(); }
+
+    status_t init() {
+        // The global scratchpad may be reallocated before the node runs, so
+        // the node gets a scratchpad of its own instead.
+        CHECK(primitive_iface_->create_deferred_scratchpad(scratchpad_));
+        scratchpad_storage_ = scratchpad_
+                ? scratchpad_->get_memory_storage()
+                : primitive_iface_->scratchpad_memory_storage(ctx_);
+        init_regions();
+        return status::success;
+    }
+
+    bool depends_on(const node_t &other) const {
+        if (primitive_iface_ == other.primitive_iface_) return true;
+        for_(const auto &r : regions_)
+        for (const auto &o : other.regions_)
+            if (conflict(r, o)) return true;
+        return false;
+    }
+
+    status_t execute() {
+        return primitive_iface_->execute(ctx_, scratchpad_storage_);
+    }
+
+    // Indices of the dependent nodes in the graph.
+    std::vector<size_t> succs_;
+    // Number of the nodes this node still waits for.
+    int npreds_ = 0;
+
+private:
+    void add_region(
+            const memory_storage_t *storage, size_t size, bool is_write) {
+        if (!storage || size == 0) return;
+        const char *ptr = static_cast<const char *>(storage->data_handle());
+        if (ptr) regions_.push_back({ptr, ptr + size, is_write});
+    }
+
+    void init_regions() {
+        for (const auto &arg : ctx_.args()) {
+            const memory_t *mem = arg.second.mem();
+            if (!mem) continue;
+            const memory_desc_wrapper mdw(mem->md());
+            for (int i = 0; i < (int)mem->get_num_handles(); i++)
+                add_region(mem->memory_storage(i),
+                        mdw.size(i, true, /* include_offset0 = */ true),
+                        !arg.second.is_const());
+        }
+        const auto *pd = primitive_iface_->pd()->impl().get();
+        add_region(scratchpad_storage_,
+                pd->scratchpad_size(pd->attr()->scratchpad_mode_), true);
+    }
+
+    primitive_iface_t *primitive_iface_;
+    exec_ctx_t ctx_;
+    std::unique_ptr<scratchpad_t> scratchpad_;
+    const memory_storage_t *scratchpad_storage_;
+    std::vector<region_t> regions_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(node_t);
+};
+
+// The state of a graph execution. It is also the threadpool the executions
+// submit their `parallel()` calls to.
+struct exec_dag_t::run_state_t : public threadpool_interop::threadpool_iface {
+    run_state_t(std::vector<std::unique_ptr<node_t>> &&nodes, int nthr)
+        : nodes_(std::move(nodes)), nremaining_(nodes_.size()), nthr_(nthr) {
+        for (size_t i = 0; i < nodes_.size(); i++)
+            if (nodes_[i]->npreds_ == 0) ready_.push_back(i);
+    }
+
+    int get_num_threads() const override { return nthr_; }
+    bool get_in_parallel() const override { return in_parallel_for; }
+    uint64_t get_flags() const override { return 0; }
+    void wait() override {}
+
+    // Runs the iterations on the calling thread and on the tasks that join to
+    // help.
+    void parallel_for(int n, const std::function<void(int, int)> &fn) override {
+        job_t job(n, fn);
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            jobs_.push_back(&job);
+        }
+        job.work();
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+        }
+        // Wait for the helpers to finish the iterations they took.
+        while (job.nhelpers_.load() > 0)
+            std::this_thread::yield();
+    }
+
+    // The body of a task of the threadpool.
+    void worker() {
+        for (;;) {
+            bool has_node = false;
+            size_t inode = 0;
+            job_t *job = nullptr;
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (nremaining_ == 0) return;
+                if (!ready_.empty()) {
+                    inode = ready_.front();
+                    ready_.pop_front();
+                    has_node = true;
+                } else {
+                    // Join the job with the fewest helpers to spread the
+                    // threads evenly between the running executions.
+                    for (auto *j : jobs_) {
+                        if (!j->has_work()) continue;
+                        if (!job || j->nhelpers_ < job->nhelpers_) job = j;
+                    }
+                    if (job) job->nhelpers_++;
+                }
+            }
+            if (has_node) {
+                execute(inode);
+            } else if (job) {
+                job->work();
+                job->nhelpers_--;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    status_t status() const { return status_; }
+
+private:
+    struct job_t {
+        job_t(int n, const std::function<void(int, int)> &fn)
+            : n_(n), fn_(fn) {}
+
+        bool has_work() const { return next_.load() < n_; }
+
+        void work() {
+            const bool was_in_parallel_for = in_parallel_for;
+            in_parallel_for = true;
+            for (int i = next_++; i < n_; i = next_++)
+                fn_(i, n_);
+            in_parallel_for = was_in_parallel_for;
+        }
+
+        const int n_;
+        const std::function<void(int, int)> &fn_;
+        std::atomic<int> next_ {0};
+        std::atomic<int> nhelpers_ {0};
+    };
+
+    void execute(size_t inode) {
+        auto *tp = threadpool_utils::get_active_threadpool();
+        threadpool_utils::activate_threadpool(this);
+        const status_t status = nodes_[inode]->execute();
+        if (tp)
+            threadpool_utils::activate_threadpool(tp);
+        else
+            threadpool_utils::deactivate_threadpool();
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (status != status::success && status_ == status::success)
+            status_ = status;
+        for (size_t s : nodes_[inode]->succs_)
+            if (--nodes_[s]->npreds_ == 0) ready_.push_back(s);
+        nremaining_--;
+    }
+
+    std::vector<std::unique_ptr<node_t>> nodes_;
+    size_t nremaining_;
+    const int nthr_;
+    std::deque<size_t> ready_;
+    std::vector<job_t *> jobs_;
+    status_t status_ = status::success;
+    std::mutex mutex_;
+};
+
+exec_dag_t::exec_dag_t() = default;
+exec_dag_t::~exec_dag_t() = default;
+
+status_t exec_dag_t::submit(
+        const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx) {
+    std::unique_ptr<node_t> node(new node_t(primitive_iface, ctx));
+    CHECK(node->init());
+    const size_t inode = nodes_.size();
+    for (auto &n : nodes_) {
+        if (!node->depends_on(*n)) continue;
+        n->succs_.push_back(inode);
+        node->npreds_++;
+    }
+    nodes_.push_back(std::move(node));
+    return status::success;
+}
+
+status_t exec_dag_t::run(threadpool_interop::threadpool_iface *tp) {
+    if (nodes_.empty()) return status::success;
+
+    const int nthr = tp ? std::max(1, tp->get_num_threads()) : 1;
+    std::shared_ptr<run_state_t> state(
+            new run_state_t(std::move(nodes_), nthr));
+    nodes_.clear();
+
+    if (nthr == 1 || tp->get_in_parallel()) {
+        state->worker();
+        return state->status();
+    }
+
+    // The state is captured by value since an asynchronous threadpool may
+    // run the tasks after the call returns.
+    tp->parallel_for(nthr, [state](int, int) { state->worker(); });
+    if (tp->get_flags() & threadpool_interop::threadpool_iface::ASYNCHRONOUS)
+        return status::success;
+    return state->status();
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_EXEC_DAG_HPP
+#define CPU_CPU_EXEC_DAG_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// A graph of primitive executions submitted to an out-of-order threadpool
+// stream.
+//
+// The executions are deferred until `run()`. The dependencies between them
+// are inferred from the memory they access: an execution depends on an
+// earlier one when it writes a memory region the earlier one reads or writes,
+// or reads a region the earlier one writes. The scratchpad of a primitive is
+// treated as a written region. An execution of a primitive using the global
+// scratchpad gets a scratchpad of its own when it is submitted, since the
+// global one may be reallocated by a primitive creation before the execution
+// runs. Executions of the same primitive are serialized as they share the
+// primitive resources.
+//
+// `run()` starts one task per thread of the threadpool. Each task repeatedly
+// either takes a ready execution and runs it, or helps to run the iterations
+// of a `parallel()` call issued by the other executions. Independent
+// executions thus overlap on disjoint subsets of the threads. A task never
+// waits for another task to start, hence the graph is executed correctly
+// even if the threadpool runs the tasks one by one.
+struct exec_dag_t {
+    exec_dag_t();
+    ~exec_dag_t();
+
+    // Adds the execution of `primitive_iface` with `ctx` to the graph. Memory
+    // objects are retained by the context; primitive objects are retained by
+    // the graph.
+    status_t submit(
+            const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx);
+
+    // Executes the submitted executions on `tp` and empties the graph. With
+    // an asynchronous threadpool the call returns once the tasks are
+    // submitted and the returned status doesn't reflect execution errors.
+    status_t run(threadpool_interop::threadpool_iface *tp);
+
+    size_t size() const { return nodes_.size(); }
+
+    struct node_t;
+    struct run_state_t;
+
+private:
+    std::vector<std::unique_ptr<node_t>> nodes_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(exec_dag_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
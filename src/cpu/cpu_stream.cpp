@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_stream.hpp"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// State of the thread executing primitives on a stream with thread
+// attributes, restored after the execution.
+struct exec_thread_state_t {
+    bool active = false;
+    int depth = 0;
+    int nthr = 0;
+#ifdef __linux__
+    bool affinity_saved = false;
+    cpu_set_t affinity;
+    // Worker threads keep their binding between executions, so the binding
+    // is skipped when the team of the calling thread is already bound to the
+    // same CPU mask.
+    std::vector<int> team_mask;
+    int team_nthr = 0;
+#endif
+};
+
+exec_thread_state_t &exec_thread_state() {
+    static thread_local exec_thread_state_t state;
+    return state;
+}
+
+#ifdef __linux__
+bool bind_to_cpu(int cpu) {
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+#endif
+
+} // namespace
+
+void cpu_stream_t::before_exec_hook() {
+    const int attr_nthr = impl()->num_threads();
+    const auto &mask = impl()->cpu_mask();
+    if ((attr_nthr == 0 && mask.empty()) || omp_in_parallel()) return;
+
+    // Nested executions, e.g. of primitives that execute other primitives,
+    // use the thread settings of the outer execution.
+    auto &state = exec_thread_state();
+    if (state.active) {
+        state.depth++;
+        return;
+    }
+
+    state.active = true;
+    state.nthr = omp_get_max_threads();
+    const int nthr = attr_nthr > 0 ? attr_nthr : (int)mask.size();
+    omp_set_num_threads(nthr);
+
+#ifdef __linux__
+    if (mask.empty()) return;
+    state.affinity_saved
+            = sched_getaffinity(0, sizeof(state.affinity), &state.affinity)
+            == 0;
+    bind_to_cpu(mask[0]);
+    if (nthr > 1 && (state.team_nthr != nthr || state.team_mask != mask)) {
+        const int *cpus = mask.data();
+        const int ncpus = (int)mask.size();
+        parallel(nthr, [&](int ithr, int) {
+            if (ithr > 0) bind_to_cpu(cpus[ithr % ncpus]);
+        });
+        state.team_nthr = nthr;
+        state.team_mask = mask;
+    }
+#endif
+}
+
+void cpu_stream_t::after_exec_hook() {
+    const int attr_nthr = impl()->num_threads();
+    if ((attr_nthr == 0 && impl()->cpu_mask().empty()) || omp_in_parallel())
+        return;
+
+    // Only the outermost execution restores the state.
+    auto &state = exec_thread_state();
+    if (!state.active) return;
+    if (state.depth > 0) {
+        state.depth--;
+        return;
+    }
+
+    omp_set_num_threads(state.nthr);
+#ifdef __linux__
+    if (state.affinity_saved)
+        sched_setaffinity(0, sizeof(state.affinity), &state.affinity);
+    state.affinity_saved = false;
+#endif
+    state.active = false;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -20,6 +20,8 @@
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include <memory>
+
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 #endif
 
@@ -27,27 +29,52 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_exec_dag.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
+        : stream_t(engine, stream_impl) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        init_exec_dag();
+#endif
+    }
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Applies the number of threads and the CPU mask of the stream to the
+    // parallel regions started by the calling thread.
+    void before_exec_hook() override;
+    void after_exec_hook() override;
+#endif
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    ~cpu_stream_t() override {
+        // Deferred executions must not outlive the stream.
+        if (exec_dag_) wait();
+    }
+#else
     ~cpu_stream_t() override = default;
+#endif
 
     dnnl::impl::status_t wait() override {
         // CPU execution is synchronous so return immediately
+        dnnl::impl::status_t status = dnnl::impl::status::success;
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
         if (rc == status::success && tp) {
+            if (exec_dag_) status = exec_dag_->run(tp);
             if (tp->get_flags()
                     & threadpool_interop::threadpool_iface::ASYNCHRONOUS)
                 tp->wait();
         }
 #endif
-        return dnnl::impl::status::success;
+        return status;
     }
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -55,6 +82,17 @@ struct cpu_stream_t : public stream_t {
             dnnl::threadpool_interop::threadpool_iface *threadpool)
         : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
 
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override {
+        if (!exec_dag_)
+            return stream_t::enqueue_primitive(primitive_iface, ctx);
+        // Bound the cost of the dependency analysis, which is quadratic in
+        // the number of the deferred executions.
+        if (exec_dag_->size() >= max_exec_dag_size) CHECK(wait());
+        return exec_dag_->submit(primitive_iface, ctx);
+    }
+
     void before_exec_hook() override {
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
@@ -64,6 +102,20 @@ struct cpu_stream_t : public stream_t {
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+
+private:
+    static constexpr size_t max_exec_dag_size = 256;
+
+    // Out-of-order streams defer the executions to a dependency graph.
+    void init_exec_dag() {
+        dnnl::threadpool_interop::threadpool_iface *tp = nullptr;
+        auto rc = this->get_threadpool(&tp);
+        if (rc == status::success && tp
+                && (flags() & stream_flags::out_of_order))
+            exec_dag_.reset(new exec_dag_t());
+    }
+
+    std::unique_ptr<exec_dag_t> exec_dag_;
 #endif
 };
 
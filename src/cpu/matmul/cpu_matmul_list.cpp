@@ -29,6 +29,9 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#if DNNL_EXPERIMENTAL_GROUPED_MEMORY
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+#endif
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -92,6 +95,8 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(ref_matmul_int8_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
+        CPU_INSTANCE_GROUPED_AVX512(brgemm_grouped_matmul_t<avx512_core>)
+        CPU_INSTANCE_GROUPED_AVX2(brgemm_grouped_matmul_t<avx2>)
         CPU_INSTANCE_GROUPED(ref_grouped_t)
         /* eol */
         nullptr,
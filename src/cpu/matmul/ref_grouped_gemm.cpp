@@ -122,9 +122,9 @@ status_t ref_grouped_t::execute(const exec_ctx_t &ctx) const {
 
     // Parallelize over groups (experts in MoE)
     // Expectation is to see 128-256+ groups, with varying M per group
-    // and possibly some empty groups (M == 0)
+    // and possibly some empty groups (M == 0), hence the dynamic scheduling
     std::atomic<status_t> st(status::success);
-    parallel_nd(group_count, [&](dim_t group_id) {
+    parallel_nd_dynamic(group_count, [&](dim_t group_id) {
         const dim_t src_offset_start
                 = (group_id == 0) ? 0 : src_offsets[group_id - 1];
         const dim_t src_offset_end = src_offsets[group_id];
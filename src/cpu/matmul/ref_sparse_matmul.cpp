@@ -157,8 +157,9 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     if (is_src_sparse) {
         // With a sparse source tensor, the matrix multiplication is carried out
         // for a sparse multiplier with parallelization over the sparse rows
-        // of the multiplier matrix.
-        parallel_nd(M, [=](dim_t m) {
+        // of the multiplier matrix. The rows may have very different number of
+        // non-zero elements, so they are scheduled dynamically.
+        parallel_nd_dynamic(M, [=](dim_t m) {
             const dim_t row_start = pointers[m];
             const dim_t row_end = pointers[m + 1];
 
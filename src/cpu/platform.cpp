@@ -16,7 +16,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <thread>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/stream.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -30,6 +37,12 @@
 #endif
 #endif
 
+#if defined(__linux__) && defined(__GLIBC__)
+#include <cstdio>
+#include <sched.h>
+#include <vector>
+#endif
+
 #if DNNL_X64
 #include "cpu/x64/cpu_isa_traits.hpp"
 #elif DNNL_AARCH64
@@ -296,6 +309,144 @@ unsigned get_num_cores() {
 #endif
 }
 
+#if defined(__linux__) && defined(__GLIBC__)
+namespace {
+// Reads a list of ranges like "0-3,8,10-11" from a sysfs file.
+std::vector<int> read_sysfs_list(const char *path) {
+    std::vector<int> values;
+    FILE *file = fopen(path, "r");
+    if (!file) return values;
+    int first = 0, last = 0;
+    char sep = 0;
+    while (fscanf(file, "%d", &first) == 1) {
+        last = first;
+        sep = (char)fgetc(file);
+        if (sep == '-') {
+            if (fscanf(file, "%d", &last) != 1) break;
+            sep = (char)fgetc(file);
+        }
+        for (int v = first; v <= last; v++)
+            values.push_back(v);
+        if (sep != ',') break;
+    }
+    fclose(file);
+    return values;
+}
+} // namespace
+#endif
+
+int get_num_numa_nodes() {
+#if defined(__linux__) && defined(__GLIBC__)
+    static const int num_nodes = []() {
+        cpu_set_t cpu_set;
+        const bool has_affinity
+                = ::sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0;
+        int n = 0;
+        for (const int node :
+                read_sysfs_list("/sys/devices/system/node/online")) {
+            char path[64];
+            snprintf(path, sizeof(path),
+                    "/sys/devices/system/node/node%d/cpulist", node);
+            // Nodes without CPUs available to the process, e.g. memory-only
+            // nodes, don't take part in the computations.
+            for (const int cpu : read_sysfs_list(path)) {
+                if (!has_affinity || cpu >= CPU_SETSIZE
+                        || CPU_ISSET(cpu, &cpu_set)) {
+                    n++;
+                    break;
+                }
+            }
+        }
+        return n > 0 ? n : 1;
+    }();
+    return num_nodes;
+#else
+    return 1;
+#endif
+}
+
+static std::atomic<int> &num_numa_nodes_override() {
+    static std::atomic<int> num_nodes {0};
+    return num_nodes;
+}
+
+int get_num_numa_nodes_to_use(const stream_t *stream) {
+    if (!stream || !(stream->flags() & stream_flags::numa_aware)) return 1;
+    const int num_nodes = num_numa_nodes_override().load();
+    return num_nodes > 0 ? num_nodes : get_num_numa_nodes();
+}
+
+void set_num_numa_nodes_to_use(int num_nodes) {
+    num_numa_nodes_override().store(num_nodes);
+}
+
+bool is_hybrid() {
+#if DNNL_X64
+    return x64::cpu().has(Xbyak::util::Cpu::tHYBRID);
+#else
+    return false;
+#endif
+}
+
+int get_core_type_weight() {
+#if DNNL_X64
+    if (!is_hybrid()) return core_type_weight_performance;
+    // CPUID leaf 0x1A reports the type of the core the calling thread runs
+    // on in EAX[31:24].
+    uint32_t data[4] = {};
+    Xbyak::util::Cpu::getCpuidEx(0x1A, 0, data);
+    const uint32_t core_type = data[0] >> 24;
+    if (core_type == 0x20) return core_type_weight_efficient;
+#endif
+    return core_type_weight_performance;
+}
+
+// The weights are collected by running a parallel region, so they only
+// describe the threads when the runtime binds the threads to the cores.
+// Threads of a team bound with OMP_PROC_BIND keep their cores, and all
+// threads read the same immutable weights, so the split is consistent even if
+// the binding changes later. The weights are recorded outside of a parallel
+// region only; an engine created inside one leaves them to the next engine.
+static std::vector<int> thread_core_weights;
+static std::atomic<bool> thread_core_weights_recorded {false};
+
+void init_thread_core_weights() {
+    if (thread_core_weights_recorded.load(std::memory_order_acquire)) return;
+    static std::mutex m;
+    std::lock_guard<std::mutex> guard(m);
+    if (thread_core_weights_recorded.load(std::memory_order_relaxed)) return;
+
+    std::vector<int> &w = thread_core_weights;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (omp_in_parallel()) return;
+    const int nthr = dnnl_get_max_threads();
+    if (is_hybrid() && omp_get_proc_bind() != omp_proc_bind_false
+            && nthr > 1) {
+        w.resize(nthr, core_type_weight_performance);
+        int *w_ptr = w.data();
+        parallel(nthr, [&](int ithr, int) {
+            w_ptr[ithr] = get_core_type_weight();
+        });
+        // Homogeneous teams, e.g. threads bound to P-cores only, use the
+        // regular even split.
+        if (std::all_of(w.begin(), w.end(), [&](int v) { return v == w[0]; }))
+            w.clear();
+    }
+#endif
+    thread_core_weights_recorded.store(true, std::memory_order_release);
+}
+
+const int *get_thread_core_weights(int nthr) {
+    if (!thread_core_weights_recorded.load(std::memory_order_acquire))
+        return nullptr;
+    // The weights describe the team they were recorded for. A team of
+    // another size may be placed on other cores, e.g. with
+    // OMP_PROC_BIND=spread, so it uses the even split.
+    const auto &w = thread_core_weights;
+    if (w.empty() || nthr <= 1 || nthr != (int)w.size()) return nullptr;
+    return w.data();
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 // The purpose of this function is to return the potential maximum number of
 // threads in user's threadpool. It is assumed that the number of threads in an
@@ -182,6 +182,34 @@ unsigned DNNL_API get_num_cores();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
+// Returns the number of NUMA nodes with CPUs available to the process, or 1
+// if the topology cannot be queried.
+int DNNL_API get_num_numa_nodes();
+// Returns the number of NUMA nodes to split the work of a primitive between:
+// all the nodes for NUMA-aware streams and 1 otherwise.
+int get_num_numa_nodes_to_use(const stream_t *stream);
+// Overrides the number of NUMA nodes used by NUMA-aware streams, 0 restores
+// the number of nodes of the system. Used for testing.
+void DNNL_API set_num_numa_nodes_to_use(int num_nodes);
+
+// Relative throughput of the core types of hybrid CPUs used to weight the
+// work distribution between threads.
+constexpr int core_type_weight_performance = 5;
+constexpr int core_type_weight_efficient = 3;
+
+// Returns true if the CPU has cores of different types (P-cores and E-cores).
+bool DNNL_API is_hybrid();
+// Returns the weight of the core type the calling thread currently runs on.
+int DNNL_API get_core_type_weight();
+// Collects the core type weights of the threads of a default-sized team.
+// Called at CPU engine creation, so that the weights are ready before any
+// parallel region. Does nothing inside a parallel region.
+void init_thread_core_weights();
+// Returns the core type weights of threads 0..nthr-1, or nullptr if the work
+// should be split evenly: the CPU is not hybrid, the threads are not bound to
+// cores, all the threads run on cores of the same type, or the team size
+// differs from the one the weights were recorded for.
+const int DNNL_API *get_thread_core_weights(int nthr);
 
 constexpr int get_cache_line_size() {
     return 64;
@@ -19,6 +19,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
+#include "common/primitive_serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -630,8 +631,9 @@ status_t brgemm_desc_finalize(brgemm_desc_t *brg) {
     return status::success;
 }
 
-status_t brgemm_kernel_create(
-        brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg) {
+namespace {
+status_t brgemm_kernel_create_impl(brgemm_kernel_t **brg_kernel,
+        const brgemm_desc_t &brg, deserializer_t *d) {
     if (!brg_kernel) return status::invalid_arguments;
     *brg_kernel = nullptr;
 
@@ -665,7 +667,9 @@ status_t brgemm_kernel_create(
         }
     }
     if (!(*brg_kernel)) return status::unimplemented;
-    status_t st = (*brg_kernel)->create_kernel();
+    status_t st = d ? (*brg_kernel)->get_jit_generator()->deserialize_code(*d)
+                    : status::success;
+    if (st == status::success) st = (*brg_kernel)->create_kernel();
     if (st != status::success) {
         // `brg_kernel` points to a pointer to kernel class created by `new`.
         // If kernel creation failed, release this resource before returning.
@@ -674,6 +678,31 @@ status_t brgemm_kernel_create(
     }
     return status::success;
 }
+} // namespace
+
+status_t brgemm_kernel_create(
+        brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg) {
+    return brgemm_kernel_create_impl(brg_kernel, brg, nullptr);
+}
+
+status_t brgemm_kernel_deserialize(brgemm_kernel_t **brg_kernel,
+        const brgemm_desc_t &brg, deserializer_t &d) {
+    serialization_stream_t brg_sstream;
+    brg.serialize(brg_sstream);
+    std::vector<uint8_t> brg_data;
+    d.pop(brg_data);
+    if (brg_data != brg_sstream.get_data()) return status::invalid_arguments;
+    return brgemm_kernel_create_impl(brg_kernel, brg, &d);
+}
+
+status_t brgemm_kernel_serialize(
+        const brgemm_kernel_t *brg_kernel, serialization_stream_t &sstream) {
+    if (!brg_kernel) return status::invalid_arguments;
+    serialization_stream_t brg_sstream;
+    brg_kernel->get_brg().serialize(brg_sstream);
+    sstream.append(brg_sstream.get_data());
+    return brg_kernel->get_jit_generator()->serialize_code(sstream);
+}
 
 status_t brgemm_kernel_destroy(brgemm_kernel_t *brg_kernel) {
     delete brg_kernel;
@@ -876,6 +905,119 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
 }
 } // namespace
 
+void brgemm_desc_t::serialize(serialization_stream_t &sstream) const {
+    // The serialized parameters must match the ones used by brgemm_cmp().
+#define SERIALIZE_BRGEMM_FIELD(x) sstream.append(x)
+
+    SERIALIZE_BRGEMM_FIELD(bcast_dim);
+    SERIALIZE_BRGEMM_FIELD(load_dim);
+    SERIALIZE_BRGEMM_FIELD(reduce_dim);
+    SERIALIZE_BRGEMM_FIELD(LDA);
+    SERIALIZE_BRGEMM_FIELD(LDB);
+    SERIALIZE_BRGEMM_FIELD(LDC);
+    SERIALIZE_BRGEMM_FIELD(LDD);
+    SERIALIZE_BRGEMM_FIELD(isa_user);
+    SERIALIZE_BRGEMM_FIELD(isa_impl);
+    SERIALIZE_BRGEMM_FIELD(alpha);
+    SERIALIZE_BRGEMM_FIELD(beta);
+    SERIALIZE_BRGEMM_FIELD(dt_a);
+    SERIALIZE_BRGEMM_FIELD(dt_b);
+    SERIALIZE_BRGEMM_FIELD(dt_c);
+    SERIALIZE_BRGEMM_FIELD(dt_d);
+    SERIALIZE_BRGEMM_FIELD(dt_bias);
+    SERIALIZE_BRGEMM_FIELD(stride_a);
+    SERIALIZE_BRGEMM_FIELD(stride_b);
+    SERIALIZE_BRGEMM_FIELD(layout);
+    SERIALIZE_BRGEMM_FIELD(type);
+    SERIALIZE_BRGEMM_FIELD(is_dgmm);
+    SERIALIZE_BRGEMM_FIELD(with_sum);
+    SERIALIZE_BRGEMM_FIELD(req_cal_comp_pads);
+
+    SERIALIZE_BRGEMM_FIELD(sum_scale);
+    SERIALIZE_BRGEMM_FIELD(sum_zp);
+    SERIALIZE_BRGEMM_FIELD(sum_dt);
+    SERIALIZE_BRGEMM_FIELD(with_eltwise);
+    SERIALIZE_BRGEMM_FIELD(with_binary);
+
+    SERIALIZE_BRGEMM_FIELD(zp_type_a);
+    SERIALIZE_BRGEMM_FIELD(zp_type_b);
+    SERIALIZE_BRGEMM_FIELD(zp_type_c);
+
+    SERIALIZE_BRGEMM_FIELD(skip_scales);
+    SERIALIZE_BRGEMM_FIELD(is_oc_scale);
+    SERIALIZE_BRGEMM_FIELD(with_src_scales);
+    SERIALIZE_BRGEMM_FIELD(with_wei_scales);
+    SERIALIZE_BRGEMM_FIELD(with_dst_scales);
+    SERIALIZE_BRGEMM_FIELD(dt_wei_scales);
+    SERIALIZE_BRGEMM_FIELD(bs_group);
+
+    // Serialize all non-pointer parameters of brgemm_attr_t except derived
+    SERIALIZE_BRGEMM_FIELD(brgattr.max_bs);
+    SERIALIZE_BRGEMM_FIELD(brgattr.max_top_vpad);
+    SERIALIZE_BRGEMM_FIELD(brgattr.max_bottom_vpad);
+    SERIALIZE_BRGEMM_FIELD(brgattr.max_top_bpad);
+    SERIALIZE_BRGEMM_FIELD(brgattr.max_bottom_bpad);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_expected_A_size);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_expected_B_size);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_expected_C_size);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_innermost_loop);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_loop_order);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prefetching);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfA.dist1);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfA.dist2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfA.sprinkled);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfB.dist1);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfB.dist2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfB.sprinkled);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfC.dist1);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_prfC.dist2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.wary_A_k_tail_read);
+    SERIALIZE_BRGEMM_FIELD(brgattr.extendable_k);
+    SERIALIZE_BRGEMM_FIELD(brgattr.generate_skip_accumulation);
+    SERIALIZE_BRGEMM_FIELD(brgattr.bd_mask_level);
+    SERIALIZE_BRGEMM_FIELD(brgattr.use_uker);
+    SERIALIZE_BRGEMM_FIELD(brgattr.use_interleave_stores);
+    SERIALIZE_BRGEMM_FIELD(brgattr.b_is_vnni);
+    SERIALIZE_BRGEMM_FIELD(brgattr.fpmath_mode);
+    SERIALIZE_BRGEMM_FIELD(brgattr.LDA2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.LDB2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.LDC2_M);
+    SERIALIZE_BRGEMM_FIELD(brgattr.LDC2_N);
+    SERIALIZE_BRGEMM_FIELD(brgattr.var_bs);
+    SERIALIZE_BRGEMM_FIELD(brgattr.postops_only);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_bs_group);
+
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_bd_block);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_ld_block);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_bd_block2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_ld_block2);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_ununroll_bd_loop);
+
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_load_nt_A);
+    SERIALIZE_BRGEMM_FIELD(brgattr.hint_load_nt_B);
+    SERIALIZE_BRGEMM_FIELD(brgattr.K_koef);
+
+    if (brgattr.bd_mask_level > 0)
+        for (int i = 0; i < bcast_dim; i++) {
+            SERIALIZE_BRGEMM_FIELD(brgattr.bd_mask[i]);
+        }
+
+    if (type == brgemm_static_offs)
+        for (int i = 0; i < brgattr.max_bs; i++) {
+            SERIALIZE_BRGEMM_FIELD(brgattr.static_offsets[i].offset.A);
+            SERIALIZE_BRGEMM_FIELD(brgattr.static_offsets[i].offset.B);
+        }
+
+#undef SERIALIZE_BRGEMM_FIELD
+
+    // Unlike brgemm_cmp(), the attributes are taken into account since the
+    // serialized descriptor identifies kernels across primitives.
+    sstream.append(attr_ != nullptr);
+    if (attr_) impl::serialize(sstream, *attr_);
+    sstream.append(dst_md_ != nullptr);
+    if (dst_md_) impl::serialize(sstream, *dst_md_);
+}
+
 bool brgemm_desc_t::operator==(const brgemm_desc_t &rhs) const {
     return (brgemm_cmp(*this, rhs) == 0);
 }
@@ -185,6 +185,27 @@ status_t DNNL_API brgemm_desc_finalize(brgemm_desc_t *brg);
 status_t DNNL_API brgemm_kernel_create(
         brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg);
 
+/// Restores a BRGEMM kernel serialized with brgemm_kernel_serialize() without
+/// generating its code
+///
+/// @param brg_kernel Output BRGEMM kernel
+/// @param brg BRGEMM descriptor, must match the serialized one
+/// @param d Deserializer pointing to the serialized kernel
+///
+status_t brgemm_kernel_deserialize(brgemm_kernel_t **brg_kernel,
+        const brgemm_desc_t &brg, deserializer_t &d);
+
+/// Serializes a BRGEMM kernel descriptor and code
+///
+/// @param brg_kernel BRGEMM kernel
+/// @param sstream Output serialization stream. Its content is unspecified if
+///     the function fails.
+/// @returns status::unimplemented if the kernel code cannot be restored in
+///     another process, e.g. it refers to data outside of the code buffer.
+///
+status_t brgemm_kernel_serialize(
+        const brgemm_kernel_t *brg_kernel, serialization_stream_t &sstream);
+
 /// Destroys a BRGEMM kernel
 ///
 /// @param brg_kernel BRGEMM kernel
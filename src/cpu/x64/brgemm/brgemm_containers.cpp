@@ -95,12 +95,13 @@ bool brgemm_kernel_container_t::brgemm_kernel_cmp(
     const auto lsz = lhs->get_jit_generator()->getSize();
     const auto rsz = rhs->get_jit_generator()->getSize();
     if (lsz != rsz) return (lsz < rsz);
-    const auto lcode = lhs->get_jit_generator()->CodeGenerator::getCode();
-    const auto rcode = rhs->get_jit_generator()->CodeGenerator::getCode();
+    const auto lcode = lhs->get_jit_generator()->jit_ker();
+    const auto rcode = rhs->get_jit_generator()->jit_ker();
     return (std::memcmp(lcode, rcode, lsz) < 0);
 }
 
-status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
+status_t brgemm_kernel_container_t::insert(
+        int idx, const brgemm_desc_t *brg, deserializer_t *d) {
     // Use two level hashing of brgemm kernels:
     // 1. Try to find entry in local brgemm_map_ using brgemm descriptor as a
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
@@ -109,7 +110,10 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
         brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
+        if (d)
+            CHECK(brgemm_kernel_deserialize(&brg_kernel, *brg, *d));
+        else
+            CHECK(brgemm_kernel_create(&brg_kernel, *brg));
         std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
         lock_write();
         const auto kernel_ret = get_set().insert(std::move(sptr));
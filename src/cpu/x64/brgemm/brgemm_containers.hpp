@@ -19,6 +19,7 @@
 
 #include <set>
 #include "common/rw_mutex.hpp"
+#include "common/serialization.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 
@@ -78,11 +79,19 @@ struct brgemm_kernel_container_t {
         return refs_[idx];
     }
 
-    status_t insert(int idx, const brgemm_desc_t *brg);
+    status_t insert(int idx, const brgemm_desc_t *brg) {
+        return insert(idx, brg, nullptr);
+    }
+    // Restores the kernel from the serialized code instead of generating it
+    status_t insert(int idx, const brgemm_desc_t *brg, deserializer_t &d) {
+        return insert(idx, brg, &d);
+    }
     static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
             const std::shared_ptr<brgemm_kernel_t> &rhs);
 
 private:
+    status_t insert(int idx, const brgemm_desc_t *brg, deserializer_t *d);
+
     std::vector<const brgemm_kernel_t *> refs_;
 #ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
     static utils::rw_mutex_t &rw_mutex() {
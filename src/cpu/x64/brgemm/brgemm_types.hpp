@@ -256,7 +256,7 @@ struct brgemm_desc_t {
     DNNL_API ~brgemm_desc_t();
 
     // Note: new added parameters must be taken into account in the brgemm
-    // comparison function
+    // comparison and serialization functions
     int bcast_dim = 0; // M;
     int load_dim = 0; // N;
     int reduce_dim = 0; // K;
@@ -581,6 +581,9 @@ struct brgemm_desc_t {
     bool operator==(const brgemm_desc_t &rhs) const;
     bool operator<(const brgemm_desc_t &rhs) const;
 
+    // Appends the parameters that define the kernel code.
+    void serialize(serialization_stream_t &sstream) const;
+
 private:
     primitive_attr_t *attr_ {nullptr};
     memory_desc_t *dst_md_ {nullptr};
@@ -661,6 +664,7 @@ struct brgemm_kernel_t {
     virtual status_t create_kernel() = 0;
     virtual void operator()(brgemm_kernel_params_t *) const = 0;
     virtual const jit_generator_t *get_jit_generator() const = 0;
+    virtual jit_generator_t *get_jit_generator() = 0;
     virtual const brgemm_desc_t &get_brg() const = 0;
 };
 
@@ -678,6 +682,7 @@ struct brgemm_kernel_common_t : public brgemm_kernel_t {
     status_t create_kernel() override;
     void operator()(brgemm_kernel_params_t *) const override;
     const jit_generator_t *get_jit_generator() const override;
+    jit_generator_t *get_jit_generator() override;
     const brgemm_desc_t &get_brg() const override {
         return ((jit_base_brgemm_kernel_t *)brgemm_kernel_)->get_brg();
     }
@@ -695,6 +700,7 @@ struct brgemm_amx_uker_t : public brgemm_kernel_t {
     status_t create_kernel() override;
     void operator()(brgemm_kernel_params_t *) const override;
     const jit_generator_t *get_jit_generator() const override;
+    jit_generator_t *get_jit_generator() override;
     const brgemm_desc_t &get_brg() const override {
         return ((jit_base_brgemm_kernel_t *)brgemm_kernel_)->get_brg();
     }
@@ -713,6 +719,7 @@ struct brdgmm_kernel_t : public brgemm_kernel_t {
     status_t create_kernel() override;
     void operator()(brgemm_kernel_params_t *) const override;
     const jit_generator_t *get_jit_generator() const override;
+    jit_generator_t *get_jit_generator() override;
     const brgemm_desc_t &get_brg() const override {
         return ((jit_base_brgemm_kernel_t *)brgemm_kernel_)->get_brg();
     }
@@ -1520,6 +1520,11 @@ const jit_generator_t *brdgmm_kernel_t<Wmm>::get_jit_generator() const {
     return brgemm_kernel_;
 }
 
+template <typename Wmm>
+jit_generator_t *brdgmm_kernel_t<Wmm>::get_jit_generator() {
+    return brgemm_kernel_;
+}
+
 template <typename Wmm>
 brdgmm_kernel_t<Wmm>::~brdgmm_kernel_t() {
     delete brgemm_kernel_;
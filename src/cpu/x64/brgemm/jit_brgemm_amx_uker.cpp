@@ -3116,6 +3116,10 @@ const jit_generator_t *brgemm_amx_uker_t::get_jit_generator() const {
     return brgemm_kernel_;
 }
 
+jit_generator_t *brgemm_amx_uker_t::get_jit_generator() {
+    return brgemm_kernel_;
+}
+
 brgemm_amx_uker_t::~brgemm_amx_uker_t() {
     delete brgemm_kernel_;
 }
@@ -3260,6 +3260,11 @@ const jit_generator_t *brgemm_kernel_common_t<Wmm>::get_jit_generator() const {
     return brgemm_kernel_;
 }
 
+template <typename Wmm>
+jit_generator_t *brgemm_kernel_common_t<Wmm>::get_jit_generator() {
+    return brgemm_kernel_;
+}
+
 template <typename Wmm>
 brgemm_kernel_common_t<Wmm>::~brgemm_kernel_common_t() {
     delete brgemm_kernel_;
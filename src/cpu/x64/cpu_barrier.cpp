@@ -16,6 +16,8 @@
 
 #include <assert.h>
 
+#include "common/spin_wait.hpp"
+
 #include "cpu/x64/cpu_barrier.hpp"
 
 namespace dnnl {
@@ -94,7 +96,50 @@ struct jit_t : public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_t)
 };
 
+#ifdef __linux__
+/** spin-then-park barrier, uses the lower half of the sense as a futex.
+ * A negative @p spin_count means that waiting threads never park. */
+static void hybrid_barrier(ctx_t *ctx, int nthr, int spin_count) {
+    const bool with_stats = spin_wait::get_stats_enabled();
+    const size_t sense = ctx->sense;
+    if (__atomic_add_fetch(&ctx->ctr, 1, __ATOMIC_SEQ_CST) == (size_t)nthr) {
+        ctx->ctr = 0;
+        __atomic_store_n(&ctx->sense, ~sense, __ATOMIC_SEQ_CST);
+        if (__atomic_exchange_n(&ctx->nparked, 0, __ATOMIC_SEQ_CST))
+            spin_wait::unpark_all(
+                    reinterpret_cast<volatile uint32_t *>(&ctx->sense));
+        return;
+    }
+
+    const double start_ms = with_stats ? spin_wait::now_ms() : 0;
+    const bool never_park = spin_count < 0;
+    bool parked = false;
+    for (int i = 0; ctx->sense == sense;) {
+        if (never_park || i < spin_count) {
+            if (!never_park) i++;
+            __builtin_ia32_pause();
+            continue;
+        }
+        // The last thread either sees the incremented counter and wakes the
+        // thread up, or changes the sense before the futex checks it.
+        __atomic_add_fetch(&ctx->nparked, 1, __ATOMIC_SEQ_CST);
+        spin_wait::park(reinterpret_cast<volatile uint32_t *>(&ctx->sense),
+                static_cast<uint32_t>(sense));
+        parked = true;
+    }
+    if (with_stats)
+        spin_wait::record_wait(spin_wait::now_ms() - start_ms, parked);
+}
+#endif
+
 void barrier(ctx_t *ctx, int nthr) {
+#ifdef __linux__
+    const int spin_count = spin_wait::get_spin_count();
+    if (nthr > 1 && (spin_count >= 0 || spin_wait::get_stats_enabled())) {
+        hybrid_barrier(ctx, nthr, spin_count);
+        return;
+    }
+#endif
     static jit_t j; /* XXX: constructed on load ... */
     j(ctx, nthr);
 }
@@ -40,7 +40,10 @@ STRUCT_ALIGN(CTX_ALIGNMENT, struct ctx_t {
     volatile size_t ctr;
     char pad1[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
     volatile size_t sense;
-    char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
+    // Number of threads parked on the lower half of `sense`, used by the
+    // spin-then-park barrier only.
+    volatile uint32_t nparked;
+    char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t) - sizeof(uint32_t)];
 });
 
 /* TODO: remove ctx_64_t once batch normalization switches to barrier-less
@@ -62,7 +65,13 @@ template <typename ctx_t>
 inline void ctx_init(ctx_t *ctx) {
     *ctx = utils::zero<ctx_t>();
 }
-void barrier(ctx_t *ctx, int nthr);
+
+/** synchronizes @p nthr threads
+ * Threads spin while waiting for the others. When ONEDNN_BARRIER_SPIN_COUNT
+ * is set, waiting threads spin for the given number of iterations and then
+ * park in the OS, which avoids burning time slices when the threads are
+ * oversubscribed. Barriers injected into jitted code always spin. */
+void DNNL_API barrier(ctx_t *ctx, int nthr);
 
 /** injects actual barrier implementation into another jitted code
  * @params:
@@ -0,0 +1,461 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/gated_mlp/brgemm_gated_mlp.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// With IC = 4096 the per-thread working set is dominated by the three weight
+// tiles of [IC, max_oc_blk] floats; 64 columns keep them within 3 MB while
+// still giving brgemm a full-width N dimension.
+constexpr dim_t max_m_blk = 32;
+constexpr dim_t max_oc_blk = 64;
+// The weight tiles are packed once per chunk of row blocks, so a thread packs
+// them once if all its row blocks fit in a chunk. The src and accumulator
+// tiles of a chunk are limited to 2M floats, i.e. 8 blocks with IC = 4096.
+constexpr dim_t max_chunk_buf_size = 2 * 1024 * 1024;
+
+// Converts a [rows, cols] strided tile to a dense f32 tile with `ld_out`
+// leading dimension. Strides are in elements of `in`.
+template <typename T>
+void pack_tile(float *out, dim_t ld_out, const T *in, dim_t rows, dim_t cols,
+        dim_t row_stride, dim_t col_stride) {
+    if (col_stride == 1 || row_stride != 1) {
+        for (dim_t r = 0; r < rows; r++) {
+            const T *in_r = in + r * row_stride;
+            float *out_r = out + r * ld_out;
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < cols; c++)
+                out_r[c] = static_cast<float>(in_r[c * col_stride]);
+        }
+    } else {
+        // Transposed source: walk it in its contiguous order.
+        for (dim_t c = 0; c < cols; c++) {
+            const T *in_c = in + c * col_stride;
+            PRAGMA_OMP_SIMD()
+            for (dim_t r = 0; r < rows; r++)
+                out[r * ld_out + c] = static_cast<float>(in_c[r]);
+        }
+    }
+}
+
+void pack_tile(float *out, dim_t ld_out, const char *in, data_type_t dt,
+        dim_t rows, dim_t cols, dim_t row_stride, dim_t col_stride) {
+    switch (dt) {
+        case f32:
+            pack_tile(out, ld_out, reinterpret_cast<const float *>(in), rows,
+                    cols, row_stride, col_stride);
+            break;
+        case bf16:
+            pack_tile(out, ld_out, reinterpret_cast<const bfloat16_t *>(in),
+                    rows, cols, row_stride, col_stride);
+            break;
+        case f16:
+            pack_tile(out, ld_out, reinterpret_cast<const float16_t *>(in),
+                    rows, cols, row_stride, col_stride);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <typename T>
+void store_row(T *out, const float *in, dim_t n, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i * stride] = static_cast<T>(in[i]);
+}
+
+void store_row(
+        char *out, data_type_t dt, const float *in, dim_t n, dim_t stride) {
+    switch (dt) {
+        case f32:
+            store_row(reinterpret_cast<float *>(out), in, n, stride);
+            break;
+        case bf16:
+            store_row(reinterpret_cast<bfloat16_t *>(out), in, n, stride);
+            break;
+        case f16:
+            store_row(reinterpret_cast<float16_t *>(out), in, n, stride);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// gate = act(gate) * up, in place.
+void apply_gate(float *gate, const float *up, dim_t n, alg_kind_t act) {
+    switch (act) {
+        case alg_kind::eltwise_swish:
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < n; i++)
+                gate[i] = math::swish_fwd(gate[i], 1.f) * up[i];
+            break;
+        case alg_kind::eltwise_gelu_erf:
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < n; i++)
+                gate[i] = math::gelu_erf_fwd(gate[i]) * up[i];
+            break;
+        case alg_kind::eltwise_gelu_tanh:
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < n; i++)
+                gate[i] = math::gelu_tanh_fwd(gate[i]) * up[i];
+            break;
+        default: assert(!"unsupported activation");
+    }
+}
+
+void init_strides(dims_t &strides, const memory_desc_t *md) {
+    const memory_desc_wrapper mdw(md);
+    for (int d = 0; d < 2; d++)
+        strides[d] = mdw.blocking_desc().strides[d];
+}
+
+size_t rnd_up_buf(size_t size) {
+    // Keep each sub-buffer cache-line aligned.
+    return rnd_up(size, 16);
+}
+
+// Small batches (e.g. token generation) do not have enough row blocks to
+// occupy all threads, the OC reduction is split in that case.
+void partition_threads(
+        int nthr, dim_t nb_m, dim_t nb_oc, int &nthr_m, int &nthr_oc) {
+    nthr_m = (int)nstl::min<dim_t>(nthr, nb_m);
+    nthr_oc = nb_m >= nthr ? 1 : (int)nstl::min<dim_t>(nb_oc, nthr / nthr_m);
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_gated_mlp_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_GATED_MLP(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GATED_MLP(pd_ok(), VERBOSE_INCONSISTENT_PRB);
+    VDISPATCH_GATED_MLP(attr()->has_default_values(smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS_GATE, DNNL_ARG_WEIGHTS_UP,
+                 DNNL_ARG_WEIGHTS_DOWN, DNNL_ARG_DST}) {
+        VDISPATCH_GATED_MLP(!memory_desc_wrapper(arg_md(arg)).has_zero_dim(),
+                VERBOSE_SHAPE_RESTRICTION);
+        VDISPATCH_GATED_MLP(utils::one_of(arg_md(arg)->data_type, f32, bf16,
+                                    f16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+
+    VDISPATCH_GATED_MLP(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS_GATE, DNNL_ARG_WEIGHTS_UP,
+                 DNNL_ARG_WEIGHTS_DOWN, DNNL_ARG_DST}) {
+        const memory_desc_wrapper mdw(arg_md(arg));
+        VDISPATCH_GATED_MLP(
+                mdw.is_plain() && !mdw.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    init_conf();
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_gated_mlp_t<isa>::pd_t::init_conf() {
+    auto &jcp = conf_;
+
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.activation = activation();
+
+    jcp.m_blk = nstl::min(jcp.mb, max_m_blk);
+    jcp.nb_m = div_up(jcp.mb, jcp.m_blk);
+    jcp.m_tail = jcp.mb % jcp.m_blk;
+    // The last OC block is zero-padded: padded gate columns are zero after
+    // the activation and padded down-projection rows contribute nothing, so
+    // no tail kernels are needed.
+    jcp.oc_blk = nstl::min(rnd_up(jcp.oc, 16), max_oc_blk);
+    jcp.nb_oc = div_up(jcp.oc, jcp.oc_blk);
+
+    init_strides(jcp.src_strides, arg_md(DNNL_ARG_SRC));
+    init_strides(jcp.w_gate_strides, arg_md(DNNL_ARG_WEIGHTS_GATE));
+    init_strides(jcp.w_up_strides, arg_md(DNNL_ARG_WEIGHTS_UP));
+    init_strides(jcp.w_down_strides, arg_md(DNNL_ARG_WEIGHTS_DOWN));
+    init_strides(jcp.dst_strides, arg_md(DNNL_ARG_DST));
+
+    jcp.src_dt = arg_md(DNNL_ARG_SRC)->data_type;
+    jcp.w_gate_dt = arg_md(DNNL_ARG_WEIGHTS_GATE)->data_type;
+    jcp.w_up_dt = arg_md(DNNL_ARG_WEIGHTS_UP)->data_type;
+    jcp.w_down_dt = arg_md(DNNL_ARG_WEIGHTS_DOWN)->data_type;
+    jcp.dst_dt = arg_md(DNNL_ARG_DST)->data_type;
+
+    partition_threads(dnnl_get_max_threads(), jcp.nb_m, jcp.nb_oc, jcp.nthr_m,
+            jcp.nthr_oc);
+    jcp.nthr = jcp.nthr_m * jcp.nthr_oc;
+
+    const dim_t max_nb_m_chunk = nstl::max<dim_t>(
+            1, max_chunk_buf_size / (2 * jcp.m_blk * jcp.ic));
+    jcp.nb_m_chunk = nstl::min(div_up(jcp.nb_m, jcp.nthr_m), max_nb_m_chunk);
+
+    size_t off = 0;
+    const auto book_buf = [&](size_t &buf_off, size_t size) {
+        buf_off = off;
+        off += rnd_up_buf(size);
+    };
+    book_buf(jcp.src_buf_off, jcp.nb_m_chunk * jcp.m_blk * jcp.ic);
+    book_buf(jcp.w_gate_buf_off, jcp.ic * jcp.oc_blk);
+    book_buf(jcp.w_up_buf_off, jcp.ic * jcp.oc_blk);
+    book_buf(jcp.w_down_buf_off, jcp.oc_blk * jcp.ic);
+    book_buf(jcp.gate_buf_off, jcp.m_blk * jcp.oc_blk);
+    book_buf(jcp.up_buf_off, jcp.m_blk * jcp.oc_blk);
+    book_buf(jcp.acc_buf_off, jcp.nb_m_chunk * jcp.m_blk * jcp.ic);
+    jcp.thr_buf_size = off;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_gated_mlp_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &jcp = conf_;
+
+    for (bool is_m_tail : {false, true}) {
+        const dim_t M = is_m_tail ? jcp.m_tail : jcp.m_blk;
+        for (int gemm = 0; gemm < 2; gemm++) {
+            auto &brg = brg_descs_[get_brg_kernel_idx(is_m_tail, gemm)];
+            if (M == 0) continue;
+
+            // G[M, oc_blk] = src[M, IC] * W_gate[IC, oc_blk] (same for up)
+            // acc[M, IC] += G[M, oc_blk] * W_down[oc_blk, IC]
+            const dim_t N = gemm == 0 ? jcp.oc_blk : jcp.ic;
+            const dim_t K = gemm == 0 ? jcp.ic : jcp.oc_blk;
+            const float beta = gemm == 0 ? 0.f : 1.f;
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32,
+                    /* transA = */ false, /* transB = */ false,
+                    brgemm_row_major, 1.f, beta, /* LDA = */ K, /* LDB = */ N,
+                    /* LDC = */ N, M, N, K));
+
+            brgemm_attr_t brgattr;
+            brgattr.max_bs = 1;
+            brgattr.hint_expected_A_size = M * K;
+            brgattr.hint_expected_B_size = K * N;
+            brgattr.hint_expected_C_size = M * N;
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brgemm_desc_finalize(&brg));
+        }
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_gated_mlp_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_gated_mlp_buffer, jcp.nthr * jcp.thr_buf_size);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_gated_mlp_t<isa>::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_brg_kernels; idx++) {
+        const auto &brg = pd()->get_brg_desc(idx);
+        if (brg.bcast_dim * brg.load_dim /* M*N */ == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_gated_mlp_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->conf();
+
+    const char *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const char *w_gate = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_GATE);
+    const char *w_up = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_UP);
+    const char *w_down = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_DOWN);
+    char *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto src_dsz = types::data_type_size(jcp.src_dt);
+    const auto w_gate_dsz = types::data_type_size(jcp.w_gate_dt);
+    const auto w_up_dsz = types::data_type_size(jcp.w_up_dt);
+    const auto w_down_dsz = types::data_type_size(jcp.w_down_dt);
+    const auto dst_dsz = types::data_type_size(jcp.dst_dt);
+
+    const auto &ss = jcp.src_strides;
+    const auto &gs = jcp.w_gate_strides;
+    const auto &us = jcp.w_up_strides;
+    const auto &ws = jcp.w_down_strides;
+    const auto &ds = jcp.dst_strides;
+
+    float *wsp = ctx.get_scratchpad_grantor().template get<float>(
+            key_gated_mlp_buffer);
+
+    const auto get_block_rows = [&](dim_t mb_idx) {
+        const bool is_m_tail = jcp.m_tail > 0 && mb_idx == jcp.nb_m - 1;
+        return is_m_tail ? jcp.m_tail : jcp.m_blk;
+    };
+
+    const auto store_block = [&](dim_t mb_idx, dim_t M, const float *acc) {
+        const dim_t m_start = mb_idx * jcp.m_blk;
+        for (dim_t i = 0; i < M; i++)
+            store_row(dst + (m_start + i) * ds[0] * dst_dsz, jcp.dst_dt,
+                    acc + i * jcp.ic, jcp.ic, ds[1]);
+    };
+
+    // Computes the row blocks [mb_start, mb_end), which fit in a chunk. The
+    // weight tiles are packed once and used by all the blocks of the chunk.
+    const auto compute_m_chunk = [&](float *thr_buf, dim_t mb_start,
+                                         dim_t mb_end, dim_t ocb_start,
+                                         dim_t ocb_end) {
+        float *src_buf = thr_buf + jcp.src_buf_off;
+        float *w_gate_buf = thr_buf + jcp.w_gate_buf_off;
+        float *w_up_buf = thr_buf + jcp.w_up_buf_off;
+        float *w_down_buf = thr_buf + jcp.w_down_buf_off;
+        float *gate_buf = thr_buf + jcp.gate_buf_off;
+        float *up_buf = thr_buf + jcp.up_buf_off;
+        float *acc_buf = thr_buf + jcp.acc_buf_off;
+        const dim_t blk_size = jcp.m_blk * jcp.ic;
+
+        for (dim_t mb_idx = mb_start; mb_idx < mb_end; mb_idx++) {
+            const dim_t M = get_block_rows(mb_idx);
+            const dim_t m_start = mb_idx * jcp.m_blk;
+            const dim_t off = (mb_idx - mb_start) * blk_size;
+            pack_tile(src_buf + off, jcp.ic, src + m_start * ss[0] * src_dsz,
+                    jcp.src_dt, M, jcp.ic, ss[0], ss[1]);
+            array_set(acc_buf + off, 0.f, M * jcp.ic);
+        }
+
+        brgemm_batch_element_t batch;
+        for (dim_t ocb = ocb_start; ocb < ocb_end; ocb++) {
+            const dim_t oc_start = ocb * jcp.oc_blk;
+            const dim_t noc = nstl::min(jcp.oc_blk, jcp.oc - oc_start);
+
+            pack_tile(w_gate_buf, jcp.oc_blk,
+                    w_gate + oc_start * gs[1] * w_gate_dsz, jcp.w_gate_dt,
+                    jcp.ic, noc, gs[0], gs[1]);
+            pack_tile(w_up_buf, jcp.oc_blk, w_up + oc_start * us[1] * w_up_dsz,
+                    jcp.w_up_dt, jcp.ic, noc, us[0], us[1]);
+            pack_tile(w_down_buf, jcp.ic,
+                    w_down + oc_start * ws[0] * w_down_dsz, jcp.w_down_dt,
+                    noc, jcp.ic, ws[0], ws[1]);
+            if (noc < jcp.oc_blk) {
+                for (dim_t k = 0; k < jcp.ic; k++) {
+                    array_set(w_gate_buf + k * jcp.oc_blk + noc, 0.f,
+                            jcp.oc_blk - noc);
+                    array_set(w_up_buf + k * jcp.oc_blk + noc, 0.f,
+                            jcp.oc_blk - noc);
+                }
+                array_set(w_down_buf + noc * jcp.ic, 0.f,
+                        (jcp.oc_blk - noc) * jcp.ic);
+            }
+
+            for (dim_t mb_idx = mb_start; mb_idx < mb_end; mb_idx++) {
+                const dim_t M = get_block_rows(mb_idx);
+                const bool is_m_tail = M != jcp.m_blk;
+                const auto *brg_gate_up
+                        = brg_kernels_[pd_t::get_brg_kernel_idx(is_m_tail, 0)]
+                                  .get();
+                const auto *brg_down
+                        = brg_kernels_[pd_t::get_brg_kernel_idx(is_m_tail, 1)]
+                                  .get();
+                const dim_t off = (mb_idx - mb_start) * blk_size;
+
+                batch.ptr.A = src_buf + off;
+                batch.ptr.B = w_gate_buf;
+                brgemm_kernel_execute(brg_gate_up, 1, &batch, gate_buf);
+                batch.ptr.B = w_up_buf;
+                brgemm_kernel_execute(brg_gate_up, 1, &batch, up_buf);
+
+                apply_gate(gate_buf, up_buf, M * jcp.oc_blk, jcp.activation);
+
+                batch.ptr.A = gate_buf;
+                batch.ptr.B = w_down_buf;
+                brgemm_kernel_execute(brg_down, 1, &batch, acc_buf + off);
+            }
+        }
+    };
+
+    // The thread partitioning is redone for the number of threads available
+    // at execution, which may be less than the one at creation. The
+    // scratchpad is booked for the latter.
+    const int nthr = nstl::min(dnnl_get_current_num_threads(), jcp.nthr);
+    int nthr_m {0}, nthr_oc {0};
+    partition_threads(nthr, jcp.nb_m, jcp.nb_oc, nthr_m, nthr_oc);
+
+    parallel(nthr, [&](const int ithr, const int) {
+        if (ithr >= nthr_m * nthr_oc) return;
+        const int ithr_m = ithr / nthr_oc;
+        const int ithr_oc = ithr % nthr_oc;
+
+        dim_t mb_start {0}, mb_end {0}, ocb_start {0}, ocb_end {0};
+        balance211(jcp.nb_m, nthr_m, ithr_m, mb_start, mb_end);
+        balance211(jcp.nb_oc, nthr_oc, ithr_oc, ocb_start, ocb_end);
+
+        float *thr_buf = wsp + ithr * jcp.thr_buf_size;
+        for (dim_t mb = mb_start; mb < mb_end; mb += jcp.nb_m_chunk) {
+            const dim_t mb_chunk_end = nstl::min(mb + jcp.nb_m_chunk, mb_end);
+            compute_m_chunk(thr_buf, mb, mb_chunk_end, ocb_start, ocb_end);
+            if (nthr_oc > 1) continue;
+            for (dim_t mb_idx = mb; mb_idx < mb_chunk_end; mb_idx++)
+                store_block(mb_idx, get_block_rows(mb_idx),
+                        thr_buf + jcp.acc_buf_off
+                                + (mb_idx - mb) * jcp.m_blk * jcp.ic);
+        }
+    });
+
+    if (nthr_oc == 1) return status::success;
+
+    // Each row block is owned by exactly one group of `nthr_oc` threads here,
+    // reduce their partial accumulators into the first one.
+    parallel_nd(jcp.nb_m, [&](dim_t mb_idx) {
+        const dim_t M = get_block_rows(mb_idx);
+        const dim_t ithr_0 = mb_idx * nthr_oc;
+        float *acc = wsp + ithr_0 * jcp.thr_buf_size + jcp.acc_buf_off;
+        for (int j = 1; j < nthr_oc; j++) {
+            const float *acc_j
+                    = wsp + (ithr_0 + j) * jcp.thr_buf_size + jcp.acc_buf_off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < M * jcp.ic; i++)
+                acc[i] += acc_j[i];
+        }
+        store_block(mb_idx, M, acc);
+    });
+
+    return status::success;
+}
+
+template struct brgemm_gated_mlp_t<avx512_core>;
+template struct brgemm_gated_mlp_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_GATED_MLP_BRGEMM_GATED_MLP_HPP
+#define CPU_X64_GATED_MLP_BRGEMM_GATED_MLP_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_gated_mlp_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Blocking and layout parameters of the brgemm-based gated MLP.
+//
+// dst = (act(src * W_gate) . (src * W_up)) * W_down
+//
+// For each block of `m_blk` rows the intermediate dimension (OC) is processed
+// in blocks of `oc_blk`: the gate and up tiles are computed by the same brgemm
+// kernel from a shared src tile, combined in place and immediately reduced into
+// a per-thread [m_blk, IC] accumulator by the down projection kernel. The
+// [MB, OC] intermediate tensor is never written to memory.
+//
+// A thread processes its row blocks in chunks of up to `nb_m_chunk` blocks
+// with a [m_blk, IC] accumulator per block, so each weight tile is packed
+// once per chunk rather than once per row block.
+//
+// When there are fewer row blocks than threads the OC dimension is split
+// between `nthr_oc` threads and their partial accumulators are reduced at the
+// end. The split is redone at execution for the actual number of threads.
+struct brgemm_gated_mlp_conf_t {
+    dim_t mb, ic, oc;
+    dim_t m_blk, m_tail, nb_m, nb_m_chunk;
+    dim_t oc_blk, nb_oc;
+
+    // Element strides of the 2D tensors.
+    dims_t src_strides, w_gate_strides, w_up_strides, w_down_strides,
+            dst_strides;
+
+    data_type_t src_dt, w_gate_dt, w_up_dt, w_down_dt, dst_dt;
+    alg_kind_t activation;
+
+    // Per-thread scratchpad layout, in floats. The src and accumulator
+    // buffers hold `nb_m_chunk` blocks.
+    size_t src_buf_off, w_gate_buf_off, w_up_buf_off, w_down_buf_off,
+            gate_buf_off, up_buf_off, acc_buf_off, thr_buf_size;
+    int nthr, nthr_m, nthr_oc;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_gated_mlp_t : public primitive_t {
+    struct pd_t : public cpu_gated_mlp_pd_t {
+        using cpu_gated_mlp_pd_t::cpu_gated_mlp_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_gated_mlp:", isa, ""),
+                brgemm_gated_mlp_t);
+
+        status_t init(engine_t *engine);
+
+        const brgemm_gated_mlp_conf_t &conf() const { return conf_; }
+
+        // Kernel index: [is_m_tail][0 - gate / up, 1 - down].
+        static int get_brg_kernel_idx(bool is_m_tail, int gemm) {
+            return 2 * (int)is_m_tail + gemm;
+        }
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+
+        static constexpr int max_num_brg_kernels = 4;
+
+    private:
+        void init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_gated_mlp_conf_t conf_ = utils::zero<brgemm_gated_mlp_conf_t>();
+        brgemm_desc_t brg_descs_[max_num_brg_kernels];
+    };
+
+    brgemm_gated_mlp_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::max_num_brg_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <set>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/jit_brgemm_conv.hpp"
@@ -714,6 +717,77 @@ status_t brgemm_convolution_fwd_t<isa>::add_brg_kernel(int brg_idx) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::serialize_brg_kernels(
+        std::vector<serialization_stream_t> &sstreams) const {
+    const auto _pd = pd();
+    const auto &brgs = *(_pd->brgemm_descriptors_);
+
+    // Indices sharing a descriptor share the kernel, store it once
+    std::set<const brgemm_desc_t *> serialized;
+    for (int idx = 0; idx < _pd->brgs_sz_; idx++) {
+        if (!brgemm_kernels_[idx] || !serialized.insert(brgs[idx]).second)
+            continue;
+        serialization_stream_t sstream;
+        sstream.append(idx);
+        CHECK(brgemm_kernel_serialize(brgemm_kernels_[idx], sstream));
+        sstreams.push_back(std::move(sstream));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::restore_brg_kernels() {
+    const auto _pd = pd();
+    const auto &brgs = *(_pd->brgemm_descriptors_);
+
+    size_t nkernels = 0;
+    CHECK(cache_blob().get_value((uint8_t *)&nkernels, sizeof(nkernels)));
+    for (size_t i = 0; i < nkernels; i++) {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        CHECK(cache_blob().get_binary(&data, &size));
+        const auto sstream = serialization_stream_t::from_data(
+                std::vector<uint8_t>(data, data + size));
+        deserializer_t d(sstream);
+
+        const int idx = d.pop<int>();
+        if (idx < 0 || idx >= _pd->brgs_sz_ || !brgs[idx])
+            return status::invalid_arguments;
+        // add_brg_kernel() skips the restored kernels, so the palettes are
+        // set here
+        CHECK(brgemm_kernels_.insert(idx, brgs[idx], d));
+        if (is_amx) brgemm_palettes_.insert(idx, brgs[idx]);
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    std::vector<serialization_stream_t> sstreams;
+    CHECK(serialize_brg_kernels(sstreams));
+    (*size) += sizeof(size_t);
+    // Each binary is prepended with its size.
+    for (const auto &sstream : sstreams)
+        (*size) += sstream.get_data().size() + sizeof(size_t);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    std::vector<serialization_stream_t> sstreams;
+    CHECK(serialize_brg_kernels(sstreams));
+    const size_t nkernels = sstreams.size();
+    CHECK(cache_blob.add_value((const uint8_t *)&nkernels, sizeof(nkernels)));
+    for (const auto &sstream : sstreams)
+        CHECK(cache_blob.add_binary(
+                sstream.get_data().data(), sstream.get_data().size()));
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_convolution_fwd_t<isa>::add_po_kernel(
         brgemm_desc_t *bcfg, int ker_idx, bool is_init) {
@@ -1012,6 +1086,7 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
 
     is_amx = brgemm_convolution_utils::is_amx(isa);
 
+    if (cache_blob()) CHECK(restore_brg_kernels());
     for (const auto &key_value_pair : _pd->brg_indices) {
         const int brg_idx = key_value_pair.second;
         CHECK(add_brg_kernel(brg_idx));
@@ -1394,13 +1469,22 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     // --------------- Parallel section ------------------------------
     const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
             * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
+    // NUMA-aware streams split the oc blocks between the nodes, so that each
+    // part of the weights is read by the threads of a single node.
+    int numa_nodes = platform::get_num_numa_nodes_to_use(ctx.stream());
+    if (numa_nodes > jcp.nb_oc) numa_nodes = 1;
     // TODO: consider loop by icc be innermost because for current
     // implementation if we use buffer then we accumulate in it only on row
     // or made ic_chunks = 1 if use_buffer
     // or (looks more general) increase buffer size to store several rows
 
     parallel(jcp.nthr, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
-        if (ithr >= work_amount) return;
+        // The NUMA split depends on the actual team, which is smaller than
+        // jcp.nthr e.g. when the execution is nested in a parallel region, as
+        // each node needs a thread. With the split every thread may own a part
+        // of the oc blocks, so none of them leaves early.
+        const int nodes = nthr >= numa_nodes ? numa_nodes : 1;
+        if (nodes == 1 && ithr >= work_amount) return;
 
         brgemm_batch_element_t *const __restrict brg_batch = brg_batch_global
                 + static_cast<size_t>(ithr) * jcp.adjusted_batch_size;
@@ -1436,15 +1520,33 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
         btc.input = jcp.copy_input ? btc.inp_buffer : src;
 
+        // With the NUMA split the threads of each node iterate over the oc
+        // blocks of the node in the gcndhw order.
+        int ocb_start {0}, ocb_end {jcp.nb_oc};
         dim_t start {0}, end {0};
-        balance211(work_amount, nthr, ithr, start, end);
+        if (nodes > 1) {
+            int node_ithr {0}, node_nthr {0};
+            const int node = numa_node_of_thread(
+                    nthr, ithr, nodes, node_ithr, node_nthr);
+            balance211(jcp.nb_oc, nodes, node, ocb_start, ocb_end);
+            balance211(work_amount / jcp.nb_oc * (ocb_end - ocb_start),
+                    node_nthr, node_ithr, start, end);
+        } else {
+            balance_by_core_type(work_amount, nthr, ithr, start, end);
+        }
+        const int node_nb_oc = ocb_end - ocb_start;
 
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
-        BRGEMM_CONV_ITERATOR_INIT;
+        if (nodes > 1) {
+            nd_iterator_init(start, g, jcp.ngroups, ocb, node_nb_oc, n, jcp.mb,
+                    odb, jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow);
+        } else {
+            BRGEMM_CONV_ITERATOR_INIT;
+        }
         for (auto work = start; work < end; work++) {
             btc.g = g;
             btc.n = n;
-            btc.ocb = ocb;
+            btc.ocb = ocb_start + ocb;
             btc.odb = odb;
             btc.ohb = ohb;
             btc.owb = owb;
@@ -1495,7 +1597,12 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 last_btc.ohb = ohb;
                 last_btc.owb = owb;
             }
-            BRGEMM_CONV_ITERATOR_STEP;
+            if (nodes > 1) {
+                nd_iterator_step(g, jcp.ngroups, ocb, node_nb_oc, n, jcp.mb,
+                        odb, jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow);
+            } else {
+                BRGEMM_CONV_ITERATOR_STEP;
+            }
         }
         if (is_amx) { amx_tile_release(); }
     });
@@ -146,6 +146,13 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    // The cache blob holds the code of brgemm kernels, other kernels are
+    // generated at primitive creation.
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
 protected:
     status_t init(engine_t *engine) override;
 
@@ -211,6 +218,9 @@ private:
     status_t add_po_kernel(brgemm_desc_t *bcfg, int ker_idx, bool is_init);
     status_t add_po_kernels(int i_N, int init_bcast_dim, int po_bcast_dim);
     status_t add_brg_kernel(int brg_idx);
+    status_t serialize_brg_kernels(
+            std::vector<serialization_stream_t> &sstreams) const;
+    status_t restore_brg_kernels();
 
     status_t cal_compensation(const char *__restrict weights,
             int32_t *src_zp_buffer, int32_t *s8s8_comp_buffer) const;
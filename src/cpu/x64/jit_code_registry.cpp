@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_code_registry.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_code_registry {
+
+namespace {
+constexpr size_t addr_size = sizeof(uint64_t);
+
+uint64_t read_addr(const Xbyak::uint8 *ptr) {
+    uint64_t addr = 0;
+    std::memcpy(&addr, ptr, addr_size);
+    return addr;
+}
+
+struct entry_t {
+    Xbyak::uint8 *code;
+    size_t size;
+    size_t hash;
+    std::vector<size_t> relocs;
+    int refs;
+    bool in_arena;
+};
+
+struct registry_t {
+    std::mutex mutex;
+    std::unordered_multimap<size_t, std::unique_ptr<entry_t>> entries;
+    code_arena_t arena {get_huge_page_size()};
+    Xbyak::MmapAllocator allocator {"dnnl_shared_jit_code"};
+};
+
+// The registry is never destroyed as kernels owned by static objects may
+// release their code after the static registry would have been destroyed.
+registry_t &registry() {
+    static registry_t *r = new registry_t();
+    return *r;
+}
+
+// The hash doesn't depend on the code location as the label addresses are
+// hashed as offsets from the beginning of the code.
+size_t hash_code(const Xbyak::uint8 *code, size_t size,
+        const std::vector<size_t> &relocs) {
+    const uint64_t top = reinterpret_cast<uint64_t>(code);
+    size_t seed = hash_combine(0, size);
+    size_t off = 0;
+    for (const size_t reloc : relocs) {
+        for (; off < reloc; off++)
+            seed = hash_combine(seed, code[off]);
+        seed = hash_combine(seed, read_addr(code + off) - top);
+        off += addr_size;
+    }
+    for (; off < size; off++)
+        seed = hash_combine(seed, code[off]);
+    return seed;
+}
+
+bool is_same(const entry_t &e, const Xbyak::uint8 *code, size_t size,
+        const std::vector<size_t> &relocs) {
+    if (e.size != size || e.relocs != relocs) return false;
+    const uint64_t top = reinterpret_cast<uint64_t>(code);
+    const uint64_t e_top = reinterpret_cast<uint64_t>(e.code);
+    size_t off = 0;
+    for (const size_t reloc : relocs) {
+        if (std::memcmp(e.code + off, code + off, reloc - off) != 0
+                || read_addr(e.code + reloc) - e_top
+                        != read_addr(code + reloc) - top)
+            return false;
+        off = reloc + addr_size;
+    }
+    return std::memcmp(e.code + off, code + off, size - off) == 0;
+}
+
+void release(entry_t *entry) {
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (--entry->refs > 0) return;
+
+    if (entry->in_arena) {
+        r.arena.free(entry->code, entry->size);
+    } else {
+        Xbyak::CodeArray::protect(
+                entry->code, entry->size, Xbyak::CodeArray::PROTECT_RW);
+        r.allocator.free(entry->code);
+    }
+    const auto range = r.entries.equal_range(entry->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.get() == entry) {
+            r.entries.erase(it);
+            break;
+        }
+    }
+}
+} // namespace
+
+code_arena_t::~code_arena_t() {
+    for (const auto &c : chunks_)
+        code_pages_free(c.first, c.second.writable, c.second.size);
+}
+
+Xbyak::uint8 *code_arena_t::alloc(size_t size, Xbyak::uint8 **writable) {
+    *writable = nullptr;
+    if (page_size_ == 0 || size == 0) return nullptr;
+    size = utils::rnd_up(size, block_alignment);
+
+    // Best fit, the lowest address among the smallest blocks that fit
+    auto best = free_blocks_by_size_.lower_bound({size, nullptr});
+    Xbyak::uint8 *block = nullptr;
+    size_t block_size = 0;
+    if (best != free_blocks_by_size_.end()) {
+        block = best->second;
+        block_size = best->first;
+    } else {
+        // The arena grows geometrically to keep the number of mappings low.
+        size_t chunk_size = nstl::max(size, capacity_);
+        void *chunk_writable = nullptr;
+        void *chunk
+                = code_pages_malloc(chunk_size, page_size_, &chunk_writable);
+        if (!chunk) return nullptr;
+        auto *code = static_cast<Xbyak::uint8 *>(chunk);
+        chunks_.emplace(code,
+                chunk_t {static_cast<Xbyak::uint8 *>(chunk_writable),
+                        chunk_size});
+        capacity_ += chunk_size;
+        add_free_block(code, chunk_size);
+        block = code;
+        block_size = chunk_size;
+    }
+
+    remove_free_block(free_blocks_.find(block));
+    if (block_size > size) add_free_block(block + size, block_size - size);
+
+    const auto chunk = chunk_of(block);
+    *writable = chunk->second.writable + (block - chunk->first);
+    return block;
+}
+
+void code_arena_t::free(Xbyak::uint8 *p, size_t size) {
+    size = utils::rnd_up(size, block_alignment);
+    const auto chunk = chunk_of(p);
+    const Xbyak::uint8 *chunk_end = chunk->first + chunk->second.size;
+
+    // Chunks may be adjacent in the address space, blocks are merged only
+    // within a chunk as the writable aliases of chunks are not adjacent.
+    auto next = free_blocks_.lower_bound(p);
+    if (next != free_blocks_.end() && p + size == next->first
+            && next->first < chunk_end) {
+        size += next->second;
+        next = remove_free_block(next);
+    }
+    if (next != free_blocks_.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == p && prev->first >= chunk->first) {
+            p = prev->first;
+            size += prev->second;
+            remove_free_block(prev);
+        }
+    }
+    add_free_block(p, size);
+}
+
+void code_arena_t::add_free_block(Xbyak::uint8 *p, size_t size) {
+    free_blocks_.emplace(p, size);
+    free_blocks_by_size_.emplace(size, p);
+}
+
+std::map<Xbyak::uint8 *, size_t>::iterator code_arena_t::remove_free_block(
+        std::map<Xbyak::uint8 *, size_t>::iterator it) {
+    free_blocks_by_size_.erase({it->second, it->first});
+    return free_blocks_.erase(it);
+}
+
+std::map<Xbyak::uint8 *, code_arena_t::chunk_t>::const_iterator
+code_arena_t::chunk_of(const Xbyak::uint8 *p) const {
+    auto it = chunks_.upper_bound(const_cast<Xbyak::uint8 *>(p));
+    assert(it != chunks_.begin());
+    return --it;
+}
+
+bool is_enabled() {
+    static const bool enabled = getenv_int_user("JIT_CODE_SHARING", 1);
+    return enabled && !get_jit_dump();
+}
+
+std::shared_ptr<const Xbyak::uint8> get_or_add(const Xbyak::uint8 *code,
+        size_t size, const std::vector<size_t> &relocs, bool &is_new) {
+    is_new = false;
+    if (!code || size == 0) return nullptr;
+
+    const size_t hash = hash_code(code, size, relocs);
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    entry_t *entry = nullptr;
+    const auto range = r.entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (is_same(*it->second, code, size, relocs)) {
+            entry = it->second.get();
+            break;
+        }
+    }
+
+    if (!entry) {
+        // Arena blocks are written through their writable alias, other
+        // copies are writable until they are protected below.
+        Xbyak::uint8 *writable = nullptr;
+        Xbyak::uint8 *copy = r.arena.alloc(size, &writable);
+        const bool in_arena = copy != nullptr;
+        if (!in_arena) copy = writable = r.allocator.alloc(size);
+        if (!copy) return nullptr;
+        std::memcpy(writable, code, size);
+        const uint64_t top = reinterpret_cast<uint64_t>(code);
+        const uint64_t copy_top = reinterpret_cast<uint64_t>(copy);
+        for (const size_t off : relocs) {
+            const uint64_t addr = read_addr(code + off) - top + copy_top;
+            std::memcpy(writable + off, &addr, addr_size);
+        }
+        if (!in_arena
+                && !Xbyak::CodeArray::protect(
+                        copy, size, Xbyak::CodeArray::PROTECT_RE)) {
+            r.allocator.free(copy);
+            return nullptr;
+        }
+        entry = new entry_t {copy, size, hash, relocs, 0, in_arena};
+        r.entries.emplace(hash, std::unique_ptr<entry_t>(entry));
+        is_new = true;
+    }
+
+    entry->refs++;
+    return std::shared_ptr<const Xbyak::uint8>(
+            entry->code, [entry](const Xbyak::uint8 *) { release(entry); });
+}
+
+size_t get_size() {
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    return r.entries.size();
+}
+
+} // namespace jit_code_registry
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
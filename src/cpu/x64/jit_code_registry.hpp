@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_CODE_REGISTRY_HPP
+#define CPU_X64_JIT_CODE_REGISTRY_HPP
+
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_code_registry {
+
+// Process-wide storage of generated code. Kernels that generate the same code
+// run a single read-only copy of it instead of keeping one per kernel, which
+// reduces the memory and iTLB footprint when many primitives are alive. When
+// huge pages are requested with ONEDNN_HUGE_PAGES the copies are packed into
+// them.
+
+// Returns whether the generated code is shared between kernels. Sharing can
+// be disabled with ONEDNN_JIT_CODE_SHARING=0 and is disabled when the code is
+// dumped.
+bool DNNL_API is_enabled();
+
+// Returns an executable copy of the `size` bytes of `code`, the copy is
+// released when the last kernel using it is destroyed. The label addresses
+// stored at the `relocs` offsets point into the code and are not a part of
+// its content, they are adjusted to the copy. `is_new` is set when no
+// identical code was registered before. Returns nullptr if the copy could not
+// be created.
+std::shared_ptr<const Xbyak::uint8> get_or_add(const Xbyak::uint8 *code,
+        size_t size, const std::vector<size_t> &relocs, bool &is_new);
+
+// Returns the number of distinct code copies alive.
+size_t DNNL_API get_size();
+
+// Packs code copies into pages of a given size. Every chunk of pages is mapped
+// twice, as read-execute memory the code runs from and as read-write memory
+// the code is copied through, so no page is ever writable and executable. The
+// chunks are kept until the arena is destroyed, the blocks of released copies
+// are merged with their free neighbors and reused. The arena is not
+// thread-safe.
+struct DNNL_API code_arena_t {
+    // Page size 0 disables the arena.
+    code_arena_t(size_t page_size) : page_size_(page_size) {}
+    ~code_arena_t();
+
+    // Returns the executable address of a block of at least `size` bytes and
+    // its writable alias in `writable`, or nullptr if no memory is available.
+    Xbyak::uint8 *alloc(size_t size, Xbyak::uint8 **writable);
+    void free(Xbyak::uint8 *p, size_t size);
+
+    size_t get_capacity() const { return capacity_; }
+    size_t get_num_free_blocks() const { return free_blocks_.size(); }
+
+private:
+    struct chunk_t {
+        Xbyak::uint8 *writable;
+        size_t size;
+    };
+
+    static constexpr size_t block_alignment = 64;
+
+    // Returns the chunk which contains the executable address `p`.
+    std::map<Xbyak::uint8 *, chunk_t>::const_iterator chunk_of(
+            const Xbyak::uint8 *p) const;
+
+    // Keep both views of the free blocks in sync.
+    void add_free_block(Xbyak::uint8 *p, size_t size);
+    std::map<Xbyak::uint8 *, size_t>::iterator remove_free_block(
+            std::map<Xbyak::uint8 *, size_t>::iterator it);
+
+    size_t page_size_;
+    size_t capacity_ = 0;
+    // executable address -> chunk
+    std::map<Xbyak::uint8 *, chunk_t> chunks_;
+    // executable address -> size of a free block
+    std::map<Xbyak::uint8 *, size_t> free_blocks_;
+    // (size, executable address) of free blocks, for the best fit lookup
+    std::set<std::pair<size_t, Xbyak::uint8 *>> free_blocks_by_size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(code_arena_t);
+};
+
+} // namespace jit_code_registry
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
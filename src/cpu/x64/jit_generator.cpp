@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "jit_generator.hpp"
 
 namespace dnnl {
@@ -244,6 +246,146 @@ void jit_generator_t::transpose(const Xbyak::Reg64 &reg_src,
     if (ncolumns > 4) transpose_8x4(4);
 }
 
+namespace {
+uint64_t read_addr(const uint8_t *ptr) {
+    uint64_t addr = 0;
+    std::memcpy(&addr, ptr, sizeof(addr));
+    return addr;
+}
+} // namespace
+
+void jit_generator_t::init_relocs(const std::vector<uint8_t> &unresolved_code) {
+    const uint8_t *code = CodeGenerator::getCode();
+    const size_t size = getSize();
+    const uint64_t top = reinterpret_cast<uint64_t>(code);
+    constexpr size_t addr_size = sizeof(uint64_t);
+    assert(unresolved_code.size() == size);
+
+    // Returns whether `len` bytes at `off` are zero before ready().
+    auto is_unresolved = [&](size_t off, size_t len) {
+        for (size_t k = off; k < off + len; k++)
+            if (unresolved_code[k] != 0) return false;
+        return true;
+    };
+
+    size_t i = 0;
+    // The end of the last label reference found
+    size_t prev_end = 0;
+    while (i < size) {
+        if (code[i] == unresolved_code[i]) {
+            i++;
+            continue;
+        }
+        // Label references are written by ready(). Absolute label addresses
+        // point into the code and are relocated. Displacements of forward
+        // jumps to labels, 32 or 8 bits long, do not depend on the location
+        // of the code. Any other difference comes from a relative reference
+        // to an address outside of the code.
+        bool found = false;
+        const size_t start = i < addr_size ? 0 : i - addr_size + 1;
+        for (size_t off = nstl::max(start, prev_end);
+                off <= i && off + addr_size <= size; off++) {
+            const uint64_t addr = read_addr(code + off);
+            if (is_unresolved(off, addr_size) && addr >= top
+                    && addr <= top + size) {
+                relocs_.push_back(off);
+                prev_end = i = off + addr_size;
+                found = true;
+                break;
+            }
+        }
+        for (const size_t disp_size : {sizeof(int32_t), sizeof(int8_t)}) {
+            if (found) break;
+            const size_t disp_start = i < disp_size ? 0 : i - disp_size + 1;
+            for (size_t off = nstl::max(disp_start, prev_end);
+                    off <= i && off + disp_size <= size; off++) {
+                int32_t disp = 0;
+                if (disp_size == sizeof(int32_t))
+                    std::memcpy(&disp, code + off, disp_size);
+                else
+                    disp = static_cast<int8_t>(code[off]);
+                const int64_t target = (int64_t)(off + disp_size) + disp;
+                if (is_unresolved(off, disp_size) && target >= 0
+                        && target <= (int64_t)size) {
+                    prev_end = i = off + disp_size;
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (!found) {
+            relocs_.clear();
+            is_relocatable_ = false;
+            return;
+        }
+    }
+}
+
+void jit_generator_t::restore_code() {
+    db(code_to_restore_.data(), code_to_restore_.size());
+    // The buffer doesn't grow anymore so the label addresses can be set.
+    const uint64_t top = reinterpret_cast<uint64_t>(CodeGenerator::getCode());
+    for (const size_t off : relocs_to_restore_)
+        rewrite(off, top + read_addr(code_to_restore_.data() + off),
+                sizeof(uint64_t));
+    relocs_ = std::move(relocs_to_restore_);
+    relocs_to_restore_.clear();
+    code_to_restore_.clear();
+    code_to_restore_.shrink_to_fit();
+}
+
+bool jit_generator_t::share_code() {
+    // Only the code that doesn't depend on its location can be shared.
+    if (!is_relocatable_ || !jit_code_registry::is_enabled()) return false;
+
+    bool is_new = false;
+    shared_code_ = jit_code_registry::get_or_add(
+            CodeGenerator::getCode(), getSize(), relocs_, is_new);
+    if (!shared_code_) return false;
+    if (is_new) register_jit_code(shared_code_.get(), getSize());
+
+    // The kernel runs the shared copy, so the own buffer is released. The
+    // buffer size is kept as it is the size of the code.
+    if (CodeArray::useProtect()) setProtectModeRW(false);
+    Xbyak::MmapAllocator::free(top_);
+    top_ = nullptr;
+    maxSize_ = 0;
+    return true;
+}
+
+status_t jit_generator_t::serialize_code(
+        serialization_stream_t &sstream) const {
+    if (!jit_ker_ || !is_relocatable_) return status::unimplemented;
+
+    std::vector<uint8_t> code(jit_ker_, jit_ker_ + getSize());
+    // Label addresses are stored as offsets from the beginning of the code.
+    const uint64_t top = reinterpret_cast<uint64_t>(jit_ker_);
+    for (const size_t off : relocs_) {
+        const uint64_t offset = read_addr(code.data() + off) - top;
+        std::memcpy(code.data() + off, &offset, sizeof(offset));
+    }
+    sstream.append(code);
+    sstream.append(relocs_);
+    return status::success;
+}
+
+status_t jit_generator_t::deserialize_code(deserializer_t &d) {
+    std::vector<uint8_t> code;
+    std::vector<size_t> relocs;
+    d.pop(code);
+    d.pop(relocs);
+
+    if (code.empty()) return status::invalid_arguments;
+    for (const size_t off : relocs) {
+        if (off + sizeof(uint64_t) > code.size()
+                || read_addr(code.data() + off) > code.size())
+            return status::invalid_arguments;
+    }
+    code_to_restore_ = std::move(code);
+    relocs_to_restore_ = std::move(relocs);
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
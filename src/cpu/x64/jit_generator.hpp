@@ -18,14 +18,17 @@
 #define CPU_X64_JIT_GENERATOR_HPP
 
 #include <limits.h>
+#include <memory>
 #include <vector>
 
 #include "common/bit_cast.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_code_registry.hpp"
 
 #include "cpu/jit_utils/jit_utils.hpp"
 
@@ -2769,6 +2772,25 @@ public:
 
     const Xbyak::uint8 *jit_ker() const { return jit_ker_; }
 
+    // A 64-bit immediate that does not fit into 32 bits is likely an address
+    // of data outside of the code buffer, which makes the code impossible to
+    // restore in another process.
+    using Xbyak::CodeGenerator::mov;
+    void mov(const Xbyak::Operand &op, uint64_t imm) {
+        if (op.isREG(64) && !Xbyak::inner::IsInInt32(imm))
+            is_relocatable_ = false;
+        Xbyak::CodeGenerator::mov(op, imm);
+    }
+
+    // Serializes the generated code so that the kernel can be re-created
+    // without calling generate(). Returns status::unimplemented when the
+    // code refers to addresses outside of the code buffer.
+    status_t serialize_code(serialization_stream_t &sstream) const;
+    // Makes the following create_kernel() call restore the code serialized
+    // with serialize_code() instead of generating it. The kernel must be
+    // constructed with the same parameters as the serialized one.
+    status_t deserialize_code(deserializer_t &d);
+
     template <typename... kernel_args_t>
     void operator()(kernel_args_t... args) const {
         using jit_kernel_func_t = void (*)(const kernel_args_t... args);
@@ -2780,7 +2802,10 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
-        generate();
+        if (code_to_restore_.empty())
+            generate();
+        else
+            restore_code();
         jit_ker_ = getCode();
         return (jit_ker_) ? status::success : status::runtime_error;
     }
@@ -2794,13 +2819,34 @@ public:
 private:
     const cpu_isa_t max_cpu_isa_;
     const Xbyak::uint8 *getCode() {
+        // In AutoGrow mode the absolute addresses of labels are written by
+        // ready(), so the code is compared before and after it to find them.
+        std::vector<uint8_t> unresolved_code;
+        if (is_relocatable_ && relocs_.empty())
+            unresolved_code.assign(
+                    CodeGenerator::getCode(), CodeGenerator::getCurr());
         this->ready();
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
+        if (!unresolved_code.empty()) init_relocs(unresolved_code);
+        if (share_code()) return shared_code_.get();
         register_jit_code(code, getSize());
         return code;
     }
 
+    void init_relocs(const std::vector<uint8_t> &unresolved_code);
+    void restore_code();
+    bool share_code();
+
+    // Code offsets of the absolute addresses that point into the code.
+    std::vector<size_t> relocs_;
+    bool is_relocatable_ = true;
+    // Code and relocations set by deserialize_code().
+    std::vector<uint8_t> code_to_restore_;
+    std::vector<size_t> relocs_to_restore_;
+    // Copy of the code shared with other kernels generating the same code.
+    std::shared_ptr<const Xbyak::uint8> shared_code_;
+
     static inline bool is_initialized() {
         return Xbyak::GetError() == Xbyak::ERR_NONE;
     }
@@ -865,7 +865,8 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
         // Last one will also handle a tail if present.
         parallel(0, [=](const int ithr, const int nthr) {
             dim_t start = 0, end = 0;
-            balance211(nelems0_simd + has_tail, nthr, ithr, start, end);
+            balance_by_core_type(
+                    nelems0_simd + has_tail, nthr, ithr, start, end);
             if (start >= end) return;
 
             const bool ithr_does_tail
@@ -351,7 +351,8 @@ status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     parallel(0, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
-        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+        balance_by_core_type(
+                utils::div_up(nelems, simd_w), nthr, ithr, start, end);
         start = nstl::min(nelems, start * simd_w);
         end = nstl::min(nelems, end * simd_w);
         if (start == end) return;
@@ -451,7 +452,8 @@ status_t jit_uni_eltwise_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     parallel(0, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
-        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+        balance_by_core_type(
+                utils::div_up(nelems, simd_w), nthr, ithr, start, end);
         start = nstl::min(nelems, start * simd_w);
         end = nstl::min(nelems, end * simd_w);
         if (start == end) return;
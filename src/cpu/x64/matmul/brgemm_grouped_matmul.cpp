@@ -0,0 +1,501 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+#if DNNL_EXPERIMENTAL_GROUPED_MEMORY
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+constexpr dim_t max_n_blk = 64;
+// Converting a weight block costs roughly as much as computing this many
+// rows against it; used to weigh units when balancing the work.
+constexpr dim_t pack_cost_in_rows = 8;
+
+template <typename T>
+void cvt_row(float *out, const T *in, dim_t n, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = static_cast<float>(in[i * stride]);
+}
+
+// Converts `n` elements of `in` starting at element `idx` to f32.
+void cvt_row(float *out, data_type_t dt, const void *in, dim_t idx, dim_t n,
+        dim_t stride) {
+    switch (dt) {
+        case f32:
+            cvt_row(out, static_cast<const float *>(in) + idx, n, stride);
+            break;
+        case bf16:
+            cvt_row(out, static_cast<const bfloat16_t *>(in) + idx, n, stride);
+            break;
+        case f16:
+            cvt_row(out, static_cast<const float16_t *>(in) + idx, n, stride);
+            break;
+        default:
+            // Sub-byte and fp8 types.
+            for (dim_t i = 0; i < n; i++)
+                out[i] = io::load_float_value(dt, in, idx + i * stride);
+    }
+}
+
+template <typename T>
+void store_row(T *out, const float *in, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = static_cast<T>(in[i]);
+}
+
+void store_row(void *out, data_type_t dt, dim_t idx, const float *in, dim_t n) {
+    switch (dt) {
+        case f32: store_row(static_cast<float *>(out) + idx, in, n); break;
+        case bf16: store_row(static_cast<bfloat16_t *>(out) + idx, in, n); break;
+        case f16: store_row(static_cast<float16_t *>(out) + idx, in, n); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+size_t rnd_up_buf(size_t size) {
+    // Keep each sub-buffer cache-line aligned.
+    return rnd_up(size, 16);
+}
+
+// Unit of work: N block `nb` of group `g` for rows [m_start, m_end) of the
+// group.
+struct work_unit_t {
+    dim_t g, nb, m_start, m_end;
+};
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(src_d.is_grouped_desc() && dst_d.is_grouped_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(wei_d.is_blocking_desc() && wei_d.ndims() == 3
+                    && wei_d.matches_one_of_tag(format_tag::abc, format_tag::acb),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const bool is_fp_wei = utils::one_of(
+            wei_type, f32, bf16, f16, f8_e5m2, f8_e4m3, f4_e2m1);
+    const bool is_int_wei = utils::one_of(wei_type, u8, s8, s4, u4);
+    // Integer weights are dequantized while converting them to f32, which is
+    // only allowed for weight-only quantization.
+    VDISPATCH_MATMUL(utils::one_of(src_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(is_fp_wei || is_int_wei, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(
+            utils::one_of(dst_type, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(is_int_wei,
+                             !attr()->scales_.has_default_values(
+                                     DNNL_ARG_WEIGHTS)
+                                     && attr()->fpmath_.apply_to_int_),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                             utils::one_of(weights_md(1)->data_type, f32, bf16,
+                                     f16)
+                                     && memory_desc_wrapper(weights_md(1))
+                                                .matches_one_of_tag(
+                                                        format_tag::ab)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::scales_data_type
+                             | smask_t::scales_groups
+                             | smask_t::zero_points_data_type
+                             | smask_t::zero_points_groups
+                             | smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    CHECK(init_quantization(engine));
+
+    init_conf();
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_quantization(
+        engine_t *engine) {
+    const auto &attr_scales = attr()->scales_;
+    const auto &attr_zps = attr()->zero_points_;
+    const auto wei_type = weights_md(0)->data_type;
+
+    VDISPATCH_MATMUL(attr_scales.has_default_values(DNNL_ARG_DST),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(attr_zps.has_default_values(DNNL_ARG_SRC)
+                    && attr_zps.has_default_values(DNNL_ARG_DST),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    // Only row-wise src scales: they are applied to the accumulator.
+    if (!attr_scales.has_default_values(DNNL_ARG_SRC)) {
+        VDISPATCH_MATMUL(attr_scales.get_mask(DNNL_ARG_SRC) == src_qmask_M()
+                        && attr_scales.get(DNNL_ARG_SRC).has_default_groups(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VDISPATCH_MATMUL(utils::one_of(attr_scales.get_data_type(DNNL_ARG_SRC),
+                                 f32, bf16, f16, e8m0, f8_e4m3, f8_e5m2),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    // Column-wise or K-grouped weight scales and zero points: both are
+    // folded into the f32 weight blocks.
+    const auto wei_q_ok = [&](const quant_entries_t &q, bool scales) {
+        if (q.has_default_values(DNNL_ARG_WEIGHTS)) return true;
+        const int mask = q.get_mask(DNNL_ARG_WEIGHTS);
+        if (!utils::one_of(mask, wei_qmask_N(), wei_qmask_K() | wei_qmask_N()))
+            return false;
+        const auto dt = q.get_data_type(DNNL_ARG_WEIGHTS);
+        if (scales
+                && !utils::one_of(
+                        dt, f32, bf16, f16, e8m0, f8_e4m3, f8_e5m2))
+            return false;
+        if (!scales && !utils::one_of(dt, u8, s8, u4, s4, s32)) return false;
+        if (q.get(DNNL_ARG_WEIGHTS).has_default_groups()) return true;
+        const auto gK = q.get_group(DNNL_ARG_WEIGHTS, -2);
+        const auto gN = q.get_group(DNNL_ARG_WEIGHTS, -1);
+        return gK > 1 && K() % gK == 0 && gN == 1;
+    };
+    VDISPATCH_MATMUL(
+            wei_q_ok(attr_scales, true), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(!attr_zps.has_default_values(DNNL_ARG_WEIGHTS),
+                             utils::one_of(wei_type, u8, s8, s4, u4)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(wei_q_ok(attr_zps, false), VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    VDISPATCH_MATMUL(attr()->post_ops_.has_default_values(),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pd_t::init_conf() {
+    auto &jcp = conf_;
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const auto &attr_scales = attr()->scales_;
+    const auto &attr_zps = attr()->zero_points_;
+
+    jcp.G = src_d.sparse_desc().grouped_desc.group_count;
+    jcp.K = wei_d.dims()[1];
+    jcp.N = wei_d.dims()[2];
+    jcp.total_M = src_d.dims()[0];
+
+    jcp.m_blk = dim_t(1) << (max_num_brg_kernels - 1);
+    jcp.n_blk = nstl::min(rnd_up(jcp.N, 16), max_n_blk);
+    jcp.nb_n = div_up(jcp.N, jcp.n_blk);
+
+    jcp.src_dt = src_d.data_type();
+    jcp.wei_dt = wei_d.data_type();
+    jcp.dst_dt = dst_md()->data_type;
+    jcp.wei_stride_g = wei_d.blocking_desc().strides[0];
+    jcp.wei_stride_k = wei_d.blocking_desc().strides[1];
+    jcp.wei_stride_n = wei_d.blocking_desc().strides[2];
+
+    jcp.with_bias = with_bias();
+    jcp.bia_dt = jcp.with_bias ? weights_md(1)->data_type : data_type::undef;
+
+    jcp.with_src_scales = !attr_scales.has_default_values(DNNL_ARG_SRC);
+    jcp.src_scales_dt = attr_scales.get_data_type(DNNL_ARG_SRC);
+    jcp.with_wei_scales = !attr_scales.has_default_values(DNNL_ARG_WEIGHTS);
+    jcp.wei_scales_dt = attr_scales.get_data_type(DNNL_ARG_WEIGHTS);
+    jcp.wei_scales_gK = jcp.with_wei_scales
+                    && !attr_scales.get(DNNL_ARG_WEIGHTS).has_default_groups()
+            ? attr_scales.get_group(DNNL_ARG_WEIGHTS, -2)
+            : jcp.K;
+    jcp.with_wei_zps = !attr_zps.has_default_values(DNNL_ARG_WEIGHTS);
+    jcp.wei_zps_dt = attr_zps.get_data_type(DNNL_ARG_WEIGHTS);
+    jcp.wei_zps_gK = jcp.with_wei_zps
+                    && !attr_zps.get(DNNL_ARG_WEIGHTS).has_default_groups()
+            ? attr_zps.get_group(DNNL_ARG_WEIGHTS, -2)
+            : jcp.K;
+
+    size_t off = 0;
+    const auto book_buf = [&](size_t &buf_off, size_t size) {
+        buf_off = off;
+        off += rnd_up_buf(size);
+    };
+    book_buf(jcp.a_buf_off, jcp.m_blk * jcp.K);
+    book_buf(jcp.b_buf_off, jcp.K * jcp.n_blk);
+    book_buf(jcp.c_buf_off, jcp.m_blk * jcp.n_blk);
+    jcp.thr_buf_size = off;
+
+    jcp.nthr = dnnl_get_max_threads();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &jcp = conf_;
+
+    for (int idx = 0; idx < max_num_brg_kernels; idx++) {
+        // C[M, n_blk] = A[M, K] * B[K, n_blk]
+        const dim_t M = dim_t(1) << idx;
+        const dim_t N = jcp.n_blk;
+        const dim_t K = jcp.K;
+        auto &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32,
+                /* transA = */ false, /* transB = */ false, brgemm_row_major,
+                1.f, 0.f, /* LDA = */ K, /* LDB = */ N, /* LDC = */ N, M, N,
+                K));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.hint_expected_A_size = M * K;
+        brgattr.hint_expected_B_size = K * N;
+        brgattr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_matmul_grouped_buffer, jcp.nthr * jcp.thr_buf_size);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_brg_kernels; idx++) {
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->conf();
+
+    const void *src = CTX_IN_MEM(const void *, DNNL_ARG_SRC, 0);
+    const int32_t *src_offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const void *wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const void *bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    void *dst = CTX_OUT_MEM(void *, DNNL_ARG_DST, 0);
+    const int32_t *dst_offsets = CTX_OUT_MEM(const int32_t *, DNNL_ARG_DST, 1);
+
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const void *wei_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_zps = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
+    // Offsets are runtime data: validate them and build the work units.
+    std::vector<work_unit_t> units;
+    std::vector<dim_t> unit_cost_end;
+    dim_t total_cost = 0;
+    for (dim_t g = 0; g < jcp.G; g++) {
+        const dim_t src_start = g == 0 ? 0 : src_offsets[g - 1];
+        const dim_t src_end = src_offsets[g];
+        const dim_t dst_start = g == 0 ? 0 : dst_offsets[g - 1];
+        const dim_t dst_end = dst_offsets[g];
+        if (src_start < 0 || src_end > jcp.total_M || src_end < src_start
+                || dst_start < 0 || dst_end > jcp.total_M
+                || dst_end - dst_start != src_end - src_start)
+            return status::invalid_arguments;
+        const dim_t M = src_end - src_start;
+        if (M > 0) total_cost += jcp.nb_n * (M + pack_cost_in_rows);
+    }
+    if (total_cost == 0) return status::success;
+
+    // The work is distributed between the threads available at execution,
+    // which may be less than the ones the scratchpad is booked for.
+    const int max_nthr = nstl::min(dnnl_get_current_num_threads(), jcp.nthr);
+    const dim_t cost_per_thr = div_up(total_cost, max_nthr);
+    for (dim_t g = 0; g < jcp.G; g++) {
+        const dim_t M = src_offsets[g] - (g == 0 ? 0 : src_offsets[g - 1]);
+        if (M == 0) continue;
+        // Heavy groups are split along M so that no unit dominates a thread.
+        const dim_t nb_m = div_up(M, jcp.m_blk);
+        const dim_t n_chunks = nstl::min(
+                nb_m, div_up(M + pack_cost_in_rows, cost_per_thr));
+        const dim_t chunk = div_up(nb_m, n_chunks) * jcp.m_blk;
+        for (dim_t nb = 0; nb < jcp.nb_n; nb++)
+            for (dim_t m = 0; m < M; m += chunk) {
+                const dim_t m_end = nstl::min(M, m + chunk);
+                units.push_back({g, nb, m, m_end});
+                const dim_t prev = unit_cost_end.empty()
+                        ? 0
+                        : unit_cost_end.back();
+                unit_cost_end.push_back(
+                        prev + (m_end - m) + pack_cost_in_rows);
+            }
+    }
+    total_cost = unit_cost_end.back();
+
+    // Thread `ithr` takes the units whose accumulated cost ends in
+    // (ithr * total / nthr, (ithr + 1) * total / nthr].
+    const int nthr = (int)nstl::min<dim_t>(max_nthr, units.size());
+    std::vector<dim_t> thr_start(nthr + 1, (dim_t)units.size());
+    thr_start[0] = 0;
+    for (int ithr = 1, u = 0; ithr < nthr; ithr++) {
+        const dim_t bound = total_cost * ithr / nthr;
+        while (u < (int)units.size() && unit_cost_end[u] <= bound)
+            u++;
+        thr_start[ithr] = u;
+    }
+
+    float *wsp = ctx.get_scratchpad_grantor().template get<float>(
+            key_matmul_grouped_buffer);
+    const auto src_dsz = types::data_type_size(jcp.src_dt);
+
+    const auto pack_wei_block = [&](float *b_buf, dim_t g, dim_t nb) {
+        const dim_t n_start = nb * jcp.n_blk;
+        const dim_t nn = nstl::min(jcp.n_blk, jcp.N - n_start);
+        const dim_t wei_scales_ngK = jcp.K / jcp.wei_scales_gK;
+        const dim_t wei_zps_ngK = jcp.K / jcp.wei_zps_gK;
+        for (dim_t k = 0; k < jcp.K; k++) {
+            float *b = b_buf + k * jcp.n_blk;
+            cvt_row(b, jcp.wei_dt, wei,
+                    g * jcp.wei_stride_g + k * jcp.wei_stride_k
+                            + n_start * jcp.wei_stride_n,
+                    nn, jcp.wei_stride_n);
+            if (jcp.with_wei_zps) {
+                const dim_t off = (g * wei_zps_ngK + k / jcp.wei_zps_gK) * jcp.N
+                        + n_start;
+                for (dim_t n = 0; n < nn; n++)
+                    b[n] -= (float)io::load_int_value(
+                            jcp.wei_zps_dt, wei_zps, off + n);
+            }
+            if (jcp.with_wei_scales) {
+                const dim_t off
+                        = (g * wei_scales_ngK + k / jcp.wei_scales_gK) * jcp.N
+                        + n_start;
+                for (dim_t n = 0; n < nn; n++)
+                    b[n] *= io::load_float_value(
+                            jcp.wei_scales_dt, wei_scales, off + n);
+            }
+            if (nn < jcp.n_blk) array_set(b + nn, 0.f, jcp.n_blk - nn);
+        }
+    };
+
+    const auto compute_block = [&](float *thr_buf, dim_t g, dim_t nb,
+                                       dim_t row_start, dim_t dst_row_start,
+                                       dim_t rows) {
+        float *a_buf = thr_buf + jcp.a_buf_off;
+        float *b_buf = thr_buf + jcp.b_buf_off;
+        float *c_buf = thr_buf + jcp.c_buf_off;
+
+        const int ker_idx = pd_t::get_brg_kernel_idx(rows);
+        const dim_t M_pad = dim_t(1) << ker_idx;
+
+        brgemm_batch_element_t batch;
+        if (jcp.src_dt == f32 && rows == M_pad) {
+            batch.ptr.A = static_cast<const char *>(src)
+                    + row_start * jcp.K * src_dsz;
+        } else {
+            for (dim_t i = 0; i < rows; i++)
+                cvt_row(a_buf + i * jcp.K, jcp.src_dt, src,
+                        (row_start + i) * jcp.K, jcp.K, 1);
+            array_set(a_buf + rows * jcp.K, 0.f, (M_pad - rows) * jcp.K);
+            batch.ptr.A = a_buf;
+        }
+        batch.ptr.B = b_buf;
+        brgemm_kernel_execute(brg_kernels_[ker_idx].get(), 1, &batch, c_buf);
+
+        const dim_t n_start = nb * jcp.n_blk;
+        const dim_t nn = nstl::min(jcp.n_blk, jcp.N - n_start);
+        for (dim_t i = 0; i < rows; i++) {
+            float *c = c_buf + i * jcp.n_blk;
+            if (jcp.with_src_scales) {
+                const float s = io::load_float_value(
+                        jcp.src_scales_dt, src_scales, row_start + i);
+                PRAGMA_OMP_SIMD()
+                for (dim_t n = 0; n < nn; n++)
+                    c[n] *= s;
+            }
+            if (jcp.with_bias) {
+                for (dim_t n = 0; n < nn; n++)
+                    c[n] += io::load_float_value(
+                            jcp.bia_dt, bias, g * jcp.N + n_start + n);
+            }
+            store_row(dst, jcp.dst_dt, (dst_row_start + i) * jcp.N + n_start,
+                    c, nn);
+        }
+    };
+
+    parallel(nthr, [&](const int ithr, const int) {
+        float *thr_buf = wsp + ithr * jcp.thr_buf_size;
+        // Consecutive units of the same weight block reuse its f32 copy.
+        dim_t packed_g = -1, packed_nb = -1;
+        for (dim_t u = thr_start[ithr]; u < thr_start[ithr + 1]; u++) {
+            const auto &unit = units[u];
+            if (unit.g != packed_g || unit.nb != packed_nb) {
+                pack_wei_block(thr_buf + jcp.b_buf_off, unit.g, unit.nb);
+                packed_g = unit.g;
+                packed_nb = unit.nb;
+            }
+            const dim_t src_start = unit.g == 0 ? 0 : src_offsets[unit.g - 1];
+            const dim_t dst_start = unit.g == 0 ? 0 : dst_offsets[unit.g - 1];
+            for (dim_t m = unit.m_start; m < unit.m_end; m += jcp.m_blk) {
+                const dim_t rows = nstl::min(jcp.m_blk, unit.m_end - m);
+                compute_block(thr_buf, unit.g, unit.nb, src_start + m,
+                        dst_start + m, rows);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_EXPERIMENTAL_GROUPED_MEMORY
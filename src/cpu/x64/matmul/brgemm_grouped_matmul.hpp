@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_EXPERIMENTAL_GROUPED_MEMORY
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Blocking parameters of the brgemm-based grouped matmul.
+//
+// src: [total_M, K] grouped, wei: [G, K, N] dense, dst: [total_M, N] grouped.
+//
+// The work is split into units of (group, N block, range of M blocks). A unit
+// converts its weight block to f32 once, applying weight scales and zero
+// points on the fly, and reuses it for all M blocks of the range. Groups with
+// many rows are split into several units so that the cost of every unit stays
+// below the average cost per thread; units are then assigned to threads by
+// their accumulated cost rather than by their count, which keeps skewed
+// (MoE) group sizes balanced.
+struct brgemm_grouped_matmul_conf_t {
+    dim_t G, K, N, total_M;
+    dim_t m_blk, n_blk, nb_n;
+
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt;
+    dim_t wei_stride_g, wei_stride_k, wei_stride_n;
+
+    bool with_bias, with_src_scales, with_wei_scales, with_wei_zps;
+    data_type_t src_scales_dt, wei_scales_dt, wei_zps_dt;
+    // Weight scales and zero points group size along K (K for column-wise).
+    dim_t wei_scales_gK, wei_zps_gK;
+
+    // Per-thread scratchpad layout, in floats.
+    size_t a_buf_off, b_buf_off, c_buf_off, thr_buf_size;
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        // Weights are 3D: [G, K, N], masks include the expert dimension.
+        int wei_qmask_K() const { return (1 << 0) | (1 << 1); }
+        int wei_qmask_N() const { return (1 << 0) | (1 << 2); }
+
+        status_t init(engine_t *engine);
+
+        const brgemm_grouped_matmul_conf_t &conf() const { return conf_; }
+
+        // Rows of a block are rounded up to a power of two, one kernel per
+        // power: small groups (a few tokens per expert) do not pay for a
+        // full `m_blk` rows block.
+        static int get_brg_kernel_idx(dim_t M) {
+            int idx = 0;
+            while ((dim_t(1) << idx) < M)
+                idx++;
+            return idx;
+        }
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+
+        static constexpr int max_num_brg_kernels = 6;
+
+    private:
+        status_t init_quantization(engine_t *engine);
+        void init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_grouped_matmul_conf_t conf_
+                = utils::zero<brgemm_grouped_matmul_conf_t>();
+        brgemm_desc_t brg_descs_[max_num_brg_kernels];
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::max_num_brg_kernels];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_EXPERIMENTAL_GROUPED_MEMORY
+#endif // CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
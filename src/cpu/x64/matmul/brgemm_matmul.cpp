@@ -454,9 +454,71 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::serialize_brg_kernels(
+        std::vector<serialization_stream_t> &sstreams) const {
+    for (int idx = 0; idx < max_num_brg_kernels_matmul; idx++) {
+        if (!brg_kernels_[idx]) continue;
+        serialization_stream_t sstream;
+        sstream.append(idx);
+        CHECK(brgemm_kernel_serialize(brg_kernels_[idx].get(), sstream));
+        sstreams.push_back(std::move(sstream));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::restore_brg_kernels() {
+    size_t nkernels = 0;
+    CHECK(cache_blob().get_value((uint8_t *)&nkernels, sizeof(nkernels)));
+    for (size_t i = 0; i < nkernels; i++) {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        CHECK(cache_blob().get_binary(&data, &size));
+        const auto sstream = serialization_stream_t::from_data(
+                std::vector<uint8_t>(data, data + size));
+        deserializer_t d(sstream);
+
+        const int idx = d.pop<int>();
+        if (idx < 0 || idx >= max_num_brg_kernels_matmul)
+            return status::invalid_arguments;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_deserialize(&ker, pd()->get_brg_desc(idx), d));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    std::vector<serialization_stream_t> sstreams;
+    CHECK(serialize_brg_kernels(sstreams));
+    (*size) += sizeof(size_t);
+    // Each binary is prepended with its size.
+    for (const auto &sstream : sstreams)
+        (*size) += sstream.get_data().size() + sizeof(size_t);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    std::vector<serialization_stream_t> sstreams;
+    CHECK(serialize_brg_kernels(sstreams));
+    const size_t nkernels = sstreams.size();
+    CHECK(cache_blob.add_value((const uint8_t *)&nkernels, sizeof(nkernels)));
+    for (const auto &sstream : sstreams)
+        CHECK(cache_blob.add_binary(
+                sstream.get_data().data(), sstream.get_data().size()));
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (cache_blob()) CHECK(restore_brg_kernels());
     const int max_m_ker_idx
             = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
     const int max_n_ker_idx
@@ -476,9 +538,12 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
                 i_bs, i_init, i_M, i_N, i_K, prefetching);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        // Kernels restored from the cache blob are not generated again.
+        if (!brg_kernels_[idx]) {
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        }
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
 
@@ -586,9 +651,32 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
+
+        // With the NUMA split the threads of each node iterate over the batch,
+        // M chunks and the N chunks of the node instead of the thread grid.
+        // The weights are only node-local if they are copied to the buffer B
+        // of the thread, otherwise they are read from the user memory.
+        const int numa_nodes = brgmm_ctx.get_num_numa_nodes();
+        const bool numa_split = numa_nodes > 1;
+        int nc_start {0}, nc_end {N_chunks};
         int start {0}, end {0};
-        balance211(brgmm_ctx.get_parallel_work_amount_gemm(),
-                brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
+        if (numa_split) {
+            int node_ithr {0}, node_nthr {0};
+            const int node = numa_node_of_thread(
+                    brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, numa_nodes,
+                    node_ithr, node_nthr);
+            balance211(N_chunks, numa_nodes, node, nc_start, nc_end);
+            const int node_work_amount = static_cast<int>(
+                    bgmmc.batch * M_chunks * (nc_end - nc_start));
+            balance211(node_work_amount, node_nthr, node_ithr, start, end);
+        } else if (brgmm_ctx.parallel_reduction_is_used()) {
+            balance211(brgmm_ctx.get_parallel_work_amount_gemm(),
+                    brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
+        } else {
+            // Without the reduction ithr_bmn is the index of the thread.
+            balance_by_core_type(brgmm_ctx.get_parallel_work_amount_gemm(),
+                    brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
+        }
         int kc_start {0}, kc_end {bgmmc.K_chunks};
         if (brgmm_ctx.parallel_reduction_is_used())
             balance211((int)bgmmc.K_chunks, brgmm_ctx.get_num_threads_for_k(),
@@ -611,7 +699,11 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         int m_chunks_per_thread = div_up(M_chunks, bgmmc.nthr_m);
         int n_chunks_per_thread = div_up(N_chunks, bgmmc.nthr_n);
         int batch_per_thread = div_up(bgmmc.batch, bgmmc.nthr_b);
-        if (brgmm_ctx.is_chunks_horizontal_process_order())
+        const int node_N_chunks = nc_end - nc_start;
+        if (numa_split)
+            nd_iterator_init(start, b, bgmmc.batch, mc, M_chunks, nc_per_t,
+                    node_N_chunks);
+        else if (brgmm_ctx.is_chunks_horizontal_process_order())
             nd_iterator_init(start, bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
                     bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
                     m_chunks_per_thread, nc_per_t, n_chunks_per_thread);
@@ -619,12 +711,22 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             nd_iterator_init(start, bt, bgmmc.nthr_b, nt, bgmmc.nthr_n, mt,
                     bgmmc.nthr_m, b_per_t, batch_per_thread, nc_per_t,
                     n_chunks_per_thread, mc_per_t, m_chunks_per_thread);
-        mc = mt * m_chunks_per_thread + mc_per_t;
-        nc = nt * n_chunks_per_thread + nc_per_t;
-        b = bt * batch_per_thread + b_per_t;
+        if (numa_split) {
+            nc = nc_start + nc_per_t;
+        } else {
+            mc = mt * m_chunks_per_thread + mc_per_t;
+            nc = nt * n_chunks_per_thread + nc_per_t;
+            b = bt * batch_per_thread + b_per_t;
+        }
 
         auto advance_func = [&]() {
             ++start;
+            if (numa_split) {
+                nd_iterator_step(
+                        b, bgmmc.batch, mc, M_chunks, nc_per_t, node_N_chunks);
+                nc = nc_start + nc_per_t;
+                return;
+            }
             if (brgmm_ctx.is_chunks_horizontal_process_order())
                 nd_iterator_step(bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
                         bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
@@ -1746,6 +1848,13 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         num_threads_used_ = nthr_k_ * nthr_bmn_;
 
+        // NUMA-aware streams split the N chunks between the nodes, so that
+        // each part of the weights is read by the threads of a single node.
+        numa_nodes_ = parallel_reduction_is_used()
+                ? 1
+                : platform::get_num_numa_nodes_to_use(ctx.stream());
+        if (numa_nodes_ > nstl::min(N_chunks_, nthr_bmn_)) numa_nodes_ = 1;
+
         const bool need_to_calculate_compensation_for_a
                 = bgmmc.has_zero_point_b && !bgmmc.with_wei_decompression;
         const bool need_to_calculate_compensation_for_b = !IMPLICATION(
@@ -2285,6 +2394,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return nthr_k_ > 1 && bgmmc_.K_chunks > 1;
     }
     int get_num_threads_for_bmn() const { return nthr_bmn_; }
+    int get_num_numa_nodes() const { return numa_nodes_; }
     // ithr = ithr_k * nthr_bmn + ithr_bmn
     int get_thread_idx_for_k(int ithr) const {
         if (ithr >= num_threads_used_) return -1;
@@ -2554,6 +2664,7 @@ private:
     int parallel_work_amount_;
     int parallel_work_amount_gemm_;
     int nthr_, nthr_k_, nthr_bmn_, num_threads_used_;
+    int numa_nodes_;
     // Horizontal order means first process N (load) dim then M (bcast) dim.
     bool is_thread_chunks_exec_order_horizontal_;
     int last_brgemm_batch_size_;
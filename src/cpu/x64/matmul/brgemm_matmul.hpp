@@ -67,6 +67,7 @@ struct brgemm_matmul_t : public primitive_t {
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
         }
+        bool is_nthr_adaptive() const override { return bgmmc_.nthr_adaptive; }
 
     private:
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
@@ -85,6 +86,13 @@ struct brgemm_matmul_t : public primitive_t {
     status_t init(engine_t *engine) override;
     static constexpr data_type_t acc_type = data_type::s32;
 
+    // The cache blob holds the code of brgemm kernels, other kernels are
+    // generated at primitive creation.
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_body(ctx);
     }
@@ -94,6 +102,9 @@ private:
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
+    status_t serialize_brg_kernels(
+            std::vector<serialization_stream_t> &sstreams) const;
+    status_t restore_brg_kernels();
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *A_data_batch_ptr, const char *B_data_batch_ptr,
             int ithr, int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
@@ -1344,7 +1344,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc = zero<decltype(bgmmc)>();
     bgmmc.isa = isa;
-    bgmmc.nthr = dnnl_get_max_threads();
+    // Thread-count adaptive primitives are created for the maximum number of
+    // threads, the execution clamps it to the number of available threads.
+    const int max_nthr = get_primitive_max_threads();
+    bgmmc.nthr_adaptive = max_nthr > 0;
+    bgmmc.nthr = bgmmc.nthr_adaptive ? max_nthr : dnnl_get_max_threads();
     bgmmc.brg_type = brgemm_addr;
 
     bgmmc.src_dt = src_d.data_type();
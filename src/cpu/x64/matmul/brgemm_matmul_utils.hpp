@@ -136,6 +136,9 @@ struct brgemm_matmul_conf_t {
 
     int nthr;
     int nthr_k = 1, nthr_m = 1, nthr_n = 1, nthr_b = 1;
+    // The blocking is computed for `get_primitive_max_threads()` threads and
+    // does not depend on the number of threads available at creation time.
+    bool nthr_adaptive;
 
     bool is_thread_chunks_exec_order_horizontal;
     brgemm_kernel_hint_mem_advice_t mem_advice;
@@ -361,9 +361,8 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
 
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
+    // Rows may have very different number of non-zero elements, so they are
+    // distributed between threads dynamically.
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
@@ -372,44 +371,25 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     // If not, use 0, which means all threads.
     const int nthr = data_to_process_in_kb < threshold_in_kb;
-
-    parallel(nthr, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
-        dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
-        if (start >= end) return;
-
-        for (dim_t m = start; m < end; m++) {
-            const int row_begin = src_pointers[m];
-            const int row_end = src_pointers[m + 1];
-            const int nnz = row_end - row_begin;
-
-            sparse_matmul_kernel_t::call_params_t p;
-            p.nnz = nnz;
-            p.src_values = src_values + row_begin;
-            p.src_indices = src_indices + row_begin;
-            p.wei = weights;
-            p.dst = dst + (m * N);
-            p.block_size = kernel_->block_size();
-            (*kernel_)(&p);
-        }
-    });
 #else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
+    const int nthr = 0;
 #endif
+
+    parallel_nd_dynamic_ext(
+            nthr, M, [= COMPAT_THIS_CAPTURE](int, int, dim_t m) {
+                const int row_begin = src_pointers[m];
+                const int row_end = src_pointers[m + 1];
+                const int nnz = row_end - row_begin;
+
+                sparse_matmul_kernel_t::call_params_t p;
+                p.nnz = nnz;
+                p.src_values = src_values + row_begin;
+                p.src_indices = src_indices + row_begin;
+                p.wei = weights;
+                p.dst = dst + (m * N);
+                p.block_size = kernel_->block_size();
+                (*kernel_)(&p);
+            });
     return status::success;
 }
 
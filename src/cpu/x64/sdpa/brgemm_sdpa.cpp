@@ -0,0 +1,556 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/sdpa/brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Keys are processed in blocks of up to `max_k_blk` elements and queries in
+// blocks of up to `max_q_blk` rows. With head size 128 the per-thread working
+// set (Q, K, V, S and O tiles in f32) stays around 200 KB and fits into L2.
+constexpr dim_t max_q_blk = 32;
+constexpr dim_t max_k_blk = 128;
+
+// Converts a [rows, cols] strided tile to a dense f32 tile with `ld_out`
+// leading dimension. Strides are in elements of `in`.
+template <typename T>
+void pack_tile(float *out, dim_t ld_out, const T *in, dim_t rows, dim_t cols,
+        dim_t row_stride, dim_t col_stride) {
+    if (col_stride == 1 || row_stride != 1) {
+        for (dim_t r = 0; r < rows; r++) {
+            const T *in_r = in + r * row_stride;
+            float *out_r = out + r * ld_out;
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < cols; c++)
+                out_r[c] = static_cast<float>(in_r[c * col_stride]);
+        }
+    } else {
+        // Transposed source: walk it in its contiguous order.
+        for (dim_t c = 0; c < cols; c++) {
+            const T *in_c = in + c * col_stride;
+            PRAGMA_OMP_SIMD()
+            for (dim_t r = 0; r < rows; r++)
+                out[r * ld_out + c] = static_cast<float>(in_c[r]);
+        }
+    }
+}
+
+void pack_tile(float *out, dim_t ld_out, const char *in, data_type_t dt,
+        dim_t rows, dim_t cols, dim_t row_stride, dim_t col_stride) {
+    switch (dt) {
+        case f32:
+            pack_tile(out, ld_out, reinterpret_cast<const float *>(in), rows,
+                    cols, row_stride, col_stride);
+            break;
+        case bf16:
+            pack_tile(out, ld_out, reinterpret_cast<const bfloat16_t *>(in),
+                    rows, cols, row_stride, col_stride);
+            break;
+        case f16:
+            pack_tile(out, ld_out, reinterpret_cast<const float16_t *>(in),
+                    rows, cols, row_stride, col_stride);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <typename T>
+void add_row(float *out, const T *in, dim_t n, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] += static_cast<float>(in[i * stride]);
+}
+
+void add_row(
+        float *out, const char *in, data_type_t dt, dim_t n, dim_t stride) {
+    switch (dt) {
+        case f32:
+            add_row(out, reinterpret_cast<const float *>(in), n, stride);
+            break;
+        case bf16:
+            add_row(out, reinterpret_cast<const bfloat16_t *>(in), n, stride);
+            break;
+        case f16:
+            add_row(out, reinterpret_cast<const float16_t *>(in), n, stride);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <typename T>
+void store_row(T *out, const float *in, float scale, dim_t n, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i * stride] = static_cast<T>(in[i] * scale);
+}
+
+void store_row(char *out, data_type_t dt, const float *in, float scale,
+        dim_t n, dim_t stride) {
+    switch (dt) {
+        case f32:
+            store_row(reinterpret_cast<float *>(out), in, scale, n, stride);
+            break;
+        case bf16:
+            store_row(
+                    reinterpret_cast<bfloat16_t *>(out), in, scale, n, stride);
+            break;
+        case f16:
+            store_row(reinterpret_cast<float16_t *>(out), in, scale, n, stride);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Returns plain strides of a 4D tensor. Dimensions of size 1 get a zero
+// stride so that broadcast tensors are addressed with the same formula.
+void init_strides(dims_t &strides, const memory_desc_t *md) {
+    const memory_desc_wrapper mdw(md);
+    for (int d = 0; d < 4; d++)
+        strides[d] = mdw.dims()[d] == 1 ? 0 : mdw.blocking_desc().strides[d];
+}
+
+size_t rnd_up_buf(size_t size) {
+    // Keep each sub-buffer cache-line aligned.
+    return rnd_up(size, 16);
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_SDPA(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SDPA(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_SDPA(attr()->has_default_values(smask_t::none),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(utils::everyone_is(4, desc()->qry_md()->ndims,
+                           desc()->key_md()->ndims, desc()->val_md()->ndims,
+                           dst_md()->ndims),
+            VERBOSE_SHAPE_RESTRICTION
+            ": qry(%d) key(%d) val(%d) dst(%d) must be 4d",
+            desc()->qry_md()->ndims, desc()->key_md()->ndims,
+            desc()->val_md()->ndims, dst_md()->ndims);
+    for (const auto *md : {desc()->qry_md(), desc()->key_md(),
+                 desc()->val_md(), dst_md()})
+        VDISPATCH_SDPA(!memory_desc_wrapper(md).has_zero_dim(),
+                VERBOSE_SHAPE_RESTRICTION);
+
+    const auto is_fp = [](data_type_t dt) {
+        return utils::one_of(dt, f32, bf16, f16);
+    };
+    VDISPATCH_SDPA(is_fp(desc()->qry_md()->data_type)
+                    && is_fp(desc()->key_md()->data_type)
+                    && is_fp(desc()->val_md()->data_type)
+                    && is_fp(dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(!with_key_scales() && !with_key_zp(),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_SDPA(!with_value_scales() && !with_value_zp(),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_SDPA(utils::everyone_is(f32, kq_acc_dt(), vs_acc_dt()),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_SDPA(utils::one_of(desc()->softmax_alg, alg_kind::softmax_accurate,
+                           alg_kind::softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    if (with_attn_scale()) {
+        VDISPATCH_SDPA(is_fp(desc()->scale_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(memory_desc_wrapper(desc()->scale_md()).nelems() == 1,
+                VERBOSE_SHAPE_RESTRICTION);
+    }
+    if (with_attn_mask()) {
+        VDISPATCH_SDPA(desc()->attn_mask_md()->ndims == 4,
+                VERBOSE_SHAPE_RESTRICTION ": attn_mask(%d) must be 4d",
+                desc()->attn_mask_md()->ndims);
+        VDISPATCH_SDPA(is_fp(desc()->attn_mask_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    for (const auto *md : {desc()->qry_md(), desc()->key_md(),
+                 desc()->val_md(), dst_md(), desc()->attn_mask_md()}) {
+        if (types::is_zero_md(md)) continue;
+        const memory_desc_wrapper mdw(md);
+        VDISPATCH_SDPA(mdw.is_plain() && !mdw.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_conf(engine_t *engine) {
+    auto &jcp = conf_;
+    const auto *d = desc();
+
+    jcp.mb = d->batch();
+    jcp.q_heads = d->num_q_heads();
+    jcp.kv_heads = d->key_md()->dims[1];
+    jcp.queries = d->queries();
+    jcp.keys = d->keys();
+    jcp.head_size = d->head_size();
+    jcp.values = d->values();
+
+    // Keys and values are either shared by all query heads or grouped (GQA).
+    VDISPATCH_SDPA(jcp.kv_heads > 0 && jcp.q_heads % jcp.kv_heads == 0
+                    && d->val_md()->dims[1] == jcp.kv_heads,
+            VERBOSE_SHAPE_RESTRICTION);
+    VDISPATCH_SDPA(utils::one_of(d->key_md()->dims[0], 1, jcp.mb)
+                    && utils::one_of(d->val_md()->dims[0], 1, jcp.mb),
+            VERBOSE_SHAPE_RESTRICTION);
+
+    jcp.q_blk = nstl::min(jcp.queries, max_q_blk);
+    jcp.nb_q = div_up(jcp.queries, jcp.q_blk);
+    jcp.q_tail = jcp.queries % jcp.q_blk;
+    // Small key sequences are handled with a single block rounded up to the
+    // vector length, the padded scores are masked out.
+    jcp.k_blk = nstl::min(rnd_up(jcp.keys, 16), max_k_blk);
+    jcp.nb_k = div_up(jcp.keys, jcp.k_blk);
+
+    init_strides(jcp.q_strides, d->qry_md());
+    init_strides(jcp.k_strides, d->key_md());
+    init_strides(jcp.v_strides, d->val_md());
+    init_strides(jcp.dst_strides, dst_md());
+
+    jcp.q_dt = d->qry_md()->data_type;
+    jcp.k_dt = d->key_md()->data_type;
+    jcp.v_dt = d->val_md()->data_type;
+    jcp.dst_dt = dst_md()->data_type;
+
+    jcp.with_mask = with_attn_mask();
+    if (jcp.with_mask) {
+        const auto *msk_md = d->attn_mask_md();
+        VDISPATCH_SDPA(utils::one_of(msk_md->dims[0], 1, jcp.mb)
+                        && utils::one_of(msk_md->dims[1], 1, jcp.q_heads)
+                        && utils::one_of(msk_md->dims[2], 1, jcp.queries)
+                        && msk_md->dims[3] == jcp.keys,
+                VERBOSE_SHAPE_RESTRICTION);
+        init_strides(jcp.msk_strides, msk_md);
+        jcp.msk_dt = msk_md->data_type;
+    }
+    jcp.with_causal_mask = with_causal_mask();
+    jcp.causal_offset = d->mask_type == attn_mask_type::bottom_right
+            ? jcp.keys - jcp.queries
+            : 0;
+    jcp.inf_as_zero = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    jcp.with_scale = with_attn_scale();
+    jcp.invert_scale = d->invert_scale;
+    jcp.scale_dt = d->scale_md()->data_type;
+
+    size_t off = 0;
+    const auto book_buf = [&](size_t &buf_off, size_t size) {
+        buf_off = off;
+        off += rnd_up_buf(size);
+    };
+    book_buf(jcp.q_buf_off, jcp.q_blk * jcp.head_size);
+    book_buf(jcp.k_buf_off, jcp.head_size * jcp.k_blk);
+    book_buf(jcp.v_buf_off, jcp.k_blk * jcp.values);
+    book_buf(jcp.s_buf_off, jcp.q_blk * jcp.k_blk);
+    book_buf(jcp.o_buf_off, jcp.q_blk * jcp.values);
+    book_buf(jcp.max_buf_off, jcp.q_blk);
+    book_buf(jcp.sum_buf_off, jcp.q_blk);
+    jcp.thr_buf_size = off;
+
+    jcp.nthr = (int)nstl::min<dim_t>(
+            dnnl_get_max_threads(), jcp.mb * jcp.q_heads * jcp.nb_q);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &jcp = conf_;
+
+    for (bool is_q_tail : {false, true}) {
+        const dim_t M = is_q_tail ? jcp.q_tail : jcp.q_blk;
+        for (int gemm = 0; gemm < 2; gemm++) {
+            auto &brg = brg_descs_[get_brg_kernel_idx(is_q_tail, gemm)];
+            if (M == 0) continue;
+
+            // S[M, k_blk] = Q[M, head_size] * K[head_size, k_blk]
+            // O[M, values] += P[M, k_blk] * V[k_blk, values]
+            const dim_t N = gemm == 0 ? jcp.k_blk : jcp.values;
+            const dim_t K = gemm == 0 ? jcp.head_size : jcp.k_blk;
+            const float beta = gemm == 0 ? 0.f : 1.f;
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32,
+                    /* transA = */ false, /* transB = */ false,
+                    brgemm_row_major, 1.f, beta, /* LDA = */ K, /* LDB = */ N,
+                    /* LDC = */ N, M, N, K));
+
+            brgemm_attr_t brgattr;
+            brgattr.max_bs = 1;
+            brgattr.hint_expected_A_size = M * K;
+            brgattr.hint_expected_B_size = K * N;
+            brgattr.hint_expected_C_size = M * N;
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brgemm_desc_finalize(&brg));
+        }
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_sdpa_fwd_buffer, jcp.nthr * jcp.thr_buf_size);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_brg_kernels; idx++) {
+        const auto &brg = pd()->get_brg_desc(idx);
+        if (brg.bcast_dim * brg.load_dim /* M*N */ == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->conf();
+
+    const char *q = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const char *k = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const char *v = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    const char *msk = jcp.with_mask
+            ? CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK)
+            : nullptr;
+    char *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    float scale = 1.f;
+    if (jcp.with_scale) {
+        const void *scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+        VCHECK_ATTR_EXEC(scale_ptr != nullptr, "Attention scale is missing");
+        scale = io::load_float_value(jcp.scale_dt, scale_ptr, 0);
+        if (jcp.invert_scale) scale = 1.f / scale;
+    }
+
+    const auto q_dsz = types::data_type_size(jcp.q_dt);
+    const auto k_dsz = types::data_type_size(jcp.k_dt);
+    const auto v_dsz = types::data_type_size(jcp.v_dt);
+    const auto dst_dsz = types::data_type_size(jcp.dst_dt);
+    const auto msk_dsz = jcp.with_mask ? types::data_type_size(jcp.msk_dt) : 0;
+
+    const auto &qs = jcp.q_strides;
+    const auto &ks = jcp.k_strides;
+    const auto &vs = jcp.v_strides;
+    const auto &ds = jcp.dst_strides;
+    const auto &ms = jcp.msk_strides;
+
+    const dim_t head_group = jcp.q_heads / jcp.kv_heads;
+    constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+
+    float *wsp = ctx.get_scratchpad_grantor().template get<float>(
+            key_sdpa_fwd_buffer);
+
+    const auto compute_q_block = [&](float *thr_buf, dim_t mb, dim_t h,
+                                         dim_t qb) {
+        float *q_buf = thr_buf + jcp.q_buf_off;
+        float *k_buf = thr_buf + jcp.k_buf_off;
+        float *v_buf = thr_buf + jcp.v_buf_off;
+        float *s_buf = thr_buf + jcp.s_buf_off;
+        float *o_buf = thr_buf + jcp.o_buf_off;
+        float *max_buf = thr_buf + jcp.max_buf_off;
+        float *sum_buf = thr_buf + jcp.sum_buf_off;
+
+        const bool is_q_tail = jcp.q_tail > 0 && qb == jcp.nb_q - 1;
+        const dim_t M = is_q_tail ? jcp.q_tail : jcp.q_blk;
+        const dim_t q_start = qb * jcp.q_blk;
+        const dim_t kvh = h / head_group;
+
+        const char *q_ptr = q + (mb * qs[0] + h * qs[1] + q_start * qs[2]) * q_dsz;
+        const char *k_ptr = k + (mb * ks[0] + kvh * ks[1]) * k_dsz;
+        const char *v_ptr = v + (mb * vs[0] + kvh * vs[1]) * v_dsz;
+        const char *msk_ptr = jcp.with_mask
+                ? msk + (mb * ms[0] + h * ms[1] + q_start * ms[2]) * msk_dsz
+                : nullptr;
+
+        // Scale is folded into Q, it is cheaper than scaling every score.
+        pack_tile(q_buf, jcp.head_size, q_ptr, jcp.q_dt, M, jcp.head_size,
+                qs[2], qs[3]);
+        if (scale != 1.f) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < M * jcp.head_size; i++)
+                q_buf[i] *= scale;
+        }
+        for (dim_t i = 0; i < M; i++) {
+            max_buf[i] = neg_inf;
+            sum_buf[i] = 0.f;
+        }
+        array_set(o_buf, 0.f, M * jcp.values);
+
+        // With a causal mask the keys past the diagonal of the last row of
+        // the block are never visible and their blocks are skipped.
+        const dim_t k_end = jcp.with_causal_mask
+                ? nstl::min(jcp.keys, q_start + M + jcp.causal_offset)
+                : jcp.keys;
+
+        const auto *brg_qk
+                = brg_kernels_[pd_t::get_brg_kernel_idx(is_q_tail, 0)].get();
+        const auto *brg_pv
+                = brg_kernels_[pd_t::get_brg_kernel_idx(is_q_tail, 1)].get();
+        brgemm_batch_element_t batch;
+
+        for (dim_t k_start = 0; k_start < k_end; k_start += jcp.k_blk) {
+            const dim_t nk = nstl::min(jcp.k_blk, jcp.keys - k_start);
+
+            pack_tile(k_buf, jcp.k_blk, k_ptr + k_start * ks[3] * k_dsz,
+                    jcp.k_dt, jcp.head_size, nk, ks[2], ks[3]);
+            if (nk < jcp.k_blk) {
+                for (dim_t d = 0; d < jcp.head_size; d++)
+                    array_set(k_buf + d * jcp.k_blk + nk, 0.f, jcp.k_blk - nk);
+            }
+
+            batch.ptr.A = q_buf;
+            batch.ptr.B = k_buf;
+            brgemm_kernel_execute(brg_qk, 1, &batch, s_buf);
+
+            // Online softmax: rescale the running sums and accumulators with
+            // the updated row maximum and turn scores into probabilities.
+            for (dim_t i = 0; i < M; i++) {
+                float *s = s_buf + i * jcp.k_blk;
+                dim_t n_valid = nk;
+                if (jcp.with_causal_mask)
+                    n_valid = nstl::max<dim_t>(0,
+                            nstl::min(nk,
+                                    q_start + i + jcp.causal_offset + 1
+                                            - k_start));
+                if (jcp.with_mask && n_valid > 0)
+                    add_row(s, msk_ptr + (i * ms[2] + k_start * ms[3]) * msk_dsz,
+                            jcp.msk_dt, n_valid, ms[3]);
+
+                float row_max = neg_inf;
+                for (dim_t j = 0; j < n_valid; j++)
+                    row_max = nstl::max(row_max, s[j]);
+                const float new_max = nstl::max(max_buf[i], row_max);
+
+                if (new_max == neg_inf) {
+                    // Every key seen so far is masked out for this row.
+                    array_set(s, 0.f, jcp.k_blk);
+                    continue;
+                }
+
+                float row_sum = 0.f;
+                PRAGMA_OMP_SIMD(reduction(+ : row_sum))
+                for (dim_t j = 0; j < n_valid; j++) {
+                    s[j] = ::expf(s[j] - new_max);
+                    row_sum += s[j];
+                }
+                array_set(s + n_valid, 0.f, jcp.k_blk - n_valid);
+
+                const float alpha = ::expf(max_buf[i] - new_max);
+                if (alpha != 1.f) {
+                    float *o = o_buf + i * jcp.values;
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t j = 0; j < jcp.values; j++)
+                        o[j] *= alpha;
+                }
+                sum_buf[i] = sum_buf[i] * alpha + row_sum;
+                max_buf[i] = new_max;
+            }
+
+            pack_tile(v_buf, jcp.values, v_ptr + k_start * vs[2] * v_dsz,
+                    jcp.v_dt, nk, jcp.values, vs[2], vs[3]);
+            if (nk < jcp.k_blk)
+                array_set(v_buf + nk * jcp.values, 0.f,
+                        (jcp.k_blk - nk) * jcp.values);
+
+            batch.ptr.A = s_buf;
+            batch.ptr.B = v_buf;
+            brgemm_kernel_execute(brg_pv, 1, &batch, o_buf);
+        }
+
+        char *dst_ptr = dst
+                + (mb * ds[0] + h * ds[1] + q_start * ds[2]) * dst_dsz;
+        for (dim_t i = 0; i < M; i++) {
+            // A row with all keys masked out has a zero sum: it is either
+            // zeroed or propagated as NaN depending on the softmax algorithm.
+            const float inv_sum = sum_buf[i] > 0.f ? 1.f / sum_buf[i]
+                    : jcp.inf_as_zero
+                    ? 0.f
+                    : std::numeric_limits<float>::quiet_NaN();
+            store_row(dst_ptr + i * ds[2] * dst_dsz, jcp.dst_dt,
+                    o_buf + i * jcp.values, inv_sum, jcp.values, ds[3]);
+        }
+    };
+
+    // With a causal mask the cost of a query block grows with its index, so
+    // the blocks are distributed between threads dynamically.
+    if (jcp.with_causal_mask) {
+        parallel_nd_dynamic_ext(jcp.nthr, jcp.mb, jcp.q_heads, jcp.nb_q,
+                [&](int ithr, int, dim_t mb, dim_t h, dim_t qb) {
+                    compute_q_block(wsp + ithr * jcp.thr_buf_size, mb, h, qb);
+                });
+        return status::success;
+    }
+
+    const dim_t work_amount = jcp.mb * jcp.q_heads * jcp.nb_q;
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *thr_buf = wsp + ithr * jcp.thr_buf_size;
+        dim_t mb {0}, h {0}, qb {0};
+        nd_iterator_init(start, mb, jcp.mb, h, jcp.q_heads, qb, jcp.nb_q);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            compute_q_block(thr_buf, mb, h, qb);
+            nd_iterator_step(mb, jcp.mb, h, jcp.q_heads, qb, jcp.nb_q);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_sdpa_fwd_t<avx512_core>;
+template struct brgemm_sdpa_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_SDPA_BRGEMM_SDPA_HPP
+#define CPU_X64_SDPA_BRGEMM_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Blocking and layout parameters of the brgemm-based SDPA implementation.
+//
+// The implementation follows the flash-attention scheme: for each block of
+// `q_blk` queries the keys are processed in blocks of `k_blk`, the scores of a
+// block are computed by the first brgemm kernel (S = Q * K), normalized with
+// an online (running max and sum) softmax and immediately accumulated into the
+// output by the second brgemm kernel (O += P * V). The full [queries, keys]
+// score matrix is never materialized.
+struct brgemm_sdpa_conf_t {
+    dim_t mb, q_heads, kv_heads, queries, keys, head_size, values;
+    dim_t q_blk, q_tail, nb_q;
+    dim_t k_blk, nb_k;
+
+    // Element strides of the plain tensors, dim order is [mb, head, r, c].
+    dims_t q_strides, k_strides, v_strides, dst_strides, msk_strides;
+
+    data_type_t q_dt, k_dt, v_dt, dst_dt, msk_dt, scale_dt;
+
+    bool with_scale, invert_scale, with_mask, with_causal_mask;
+    // Offset of the causal diagonal: 0 for top-left and (keys - queries) for
+    // bottom-right alignment.
+    dim_t causal_offset;
+    bool inf_as_zero;
+
+    // Per-thread scratchpad layout, in floats.
+    size_t q_buf_off, k_buf_off, v_buf_off, s_buf_off, o_buf_off, max_buf_off,
+            sum_buf_off, thr_buf_size;
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_fwd_pd_t {
+        using cpu_sdpa_fwd_pd_t::cpu_sdpa_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_sdpa:", isa, ""),
+                brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        const brgemm_sdpa_conf_t &conf() const { return conf_; }
+
+        // Kernel index: [is_q_tail][0 - Q * K, 1 - P * V].
+        static int get_brg_kernel_idx(bool is_q_tail, int gemm) {
+            return 2 * (int)is_q_tail + gemm;
+        }
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+
+        static constexpr int max_num_brg_kernels = 4;
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_sdpa_conf_t conf_ = utils::zero<brgemm_sdpa_conf_t>();
+        brgemm_desc_t brg_descs_[max_num_brg_kernels];
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::max_num_brg_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/backend.hpp"
+#include "graph/interface/partition_hashing.hpp"
 #include "graph/interface/shape_infer.hpp"
 
 #include "graph/utils/utils.hpp"
@@ -633,6 +634,19 @@ size_t generate_constant_md_hash(
     return key;
 }
 
+size_t generate_persistent_constant_md_hash(
+        const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<dnnl::memory::desc> &const_mds) {
+    size_t key = 0;
+    for (const auto &op : ops)
+        key = hash_combine(key, partition_hashing::get_op_hash(*op));
+    for (auto &md : const_mds) {
+        auto md_hash = impl::primitive_hashing::get_md_hash(*md.get());
+        key = hash_combine(key, md_hash);
+    }
+    return key;
+}
+
 dnnl::accumulation_mode str2accumulation_mode(
         const std::string &accumulation_mode_str) {
     if (accumulation_mode_str == "strict") {
@@ -144,6 +144,13 @@ dnnl::accumulation_mode str2accumulation_mode(
 size_t generate_constant_md_hash(
         size_t part_id, const std::vector<dnnl::memory::desc> &const_mds);
 
+// Unlike generate_constant_md_hash(), identifies the partition by its ops
+// instead of its id, so the hash is the same in all processes which compile
+// the same partition.
+size_t generate_persistent_constant_md_hash(
+        const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<dnnl::memory::desc> &const_mds);
+
 // This function artificially extends the `temporary_scratchpad_t` object's
 // lifetime to keep alive the handle this scratchpad object manages.
 // An alternative approach is to manage its handles through a system of caches
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "graph/backend/dnnl/executables/split.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+split_executable_t::split_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+
+    const auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    const auto ndims = src_md.get_ndims();
+    const auto axis = static_cast<size_t>(
+            utils::try_reverse_axis(op->get_attr<int64_t>(op_attr::axis), ndims)
+                    .second);
+
+    memory::dims offsets(ndims, 0);
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        const auto dst_md
+                = make_dnnl_memory_desc(op->get_output_logical_tensor(i));
+        auto sub_md = src_md.submemory_desc(dst_md.get_dims(), offsets);
+        offsets[axis] += dst_md.get_dims()[axis];
+
+        dnnl::reorder::primitive_desc pd(p_engine, sub_md, p_engine, dst_md);
+        src_mds_.emplace_back(sub_md);
+        prims_.emplace_back(pd);
+    }
+}
+
+void split_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const memory &src = args.at(DNNL_ARG_SRC);
+    for (size_t i = 0; i < prims_.size(); ++i) {
+        memory sub_src(
+                src_mds_[i], stream.get_engine(), src.get_data_handle());
+        prims_[i].execute(stream,
+                {{DNNL_ARG_FROM, sub_src},
+                        {DNNL_ARG_TO,
+                                args.at(DNNL_ARG_MULTIPLE_DST
+                                        + static_cast<int>(i))}});
+    }
+}
+
+#ifdef DNNL_WITH_SYCL
+::sycl::event split_executable_t::execute_sycl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_SRC);
+    // The chunks are disjoint, so all the reorders only depend on the inputs
+    // events and can run concurrently.
+    std::vector<::sycl::event> events;
+    events.reserve(prims_.size());
+    for (size_t i = 0; i < prims_.size(); ++i) {
+        memory sub_src(
+                src_mds_[i], stream.get_engine(), src.get_data_handle());
+        events.emplace_back(dnnl::sycl_interop::execute(prims_[i], stream,
+                {{DNNL_ARG_FROM, sub_src},
+                        {DNNL_ARG_TO,
+                                args.at(DNNL_ARG_MULTIPLE_DST
+                                        + static_cast<int>(i))}},
+                deps));
+    }
+    if (events.size() == 1) return events[0];
+
+    auto q = dnnl::sycl_interop::get_queue(stream);
+    auto e = q.submit([&](::sycl::handler &cgh) {
+        cgh.depends_on(events);
+        cgh.single_task<class dnnl_graph_split_kernel>([]() {});
+    });
+    if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+    return e;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event split_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_SRC);
+    // The chunks are disjoint, so all the reorders only depend on the inputs
+    // events and can run concurrently.
+    std::vector<cl_event> events;
+    events.reserve(prims_.size());
+    for (size_t i = 0; i < prims_.size(); ++i) {
+        memory sub_src(
+                src_mds_[i], stream.get_engine(), src.get_data_handle());
+        events.emplace_back(dnnl::ocl_interop::execute(prims_[i], stream,
+                {{DNNL_ARG_FROM, sub_src},
+                        {DNNL_ARG_TO,
+                                args.at(DNNL_ARG_MULTIPLE_DST
+                                        + static_cast<int>(i))}},
+                deps));
+    }
+    if (events.size() == 1) return events[0];
+
+    auto q = dnnl::ocl_interop::get_command_queue(stream);
+    cl_event e;
+    auto err = xpu::ocl::clEnqueueMarkerWithWaitList(
+            q, static_cast<cl_uint>(events.size()), events.data(), &e);
+    assert(err == CL_SUCCESS);
+    MAYBE_UNUSED(err);
+    return e;
+}
+#endif
+
+arg_indices_t split_executable_t::get_arg_indices(const op_t *op) {
+    arg_indices_t args;
+    args.insert({DNNL_ARG_SRC, {indices_t::type_t::input, 0}});
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        args.insert({DNNL_ARG_MULTIPLE_DST + static_cast<int>(i),
+                {indices_t::type_t::output, i}});
+    }
+    return args;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
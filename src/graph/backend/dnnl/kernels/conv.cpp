@@ -136,6 +136,9 @@ status_t conv_fwd_t<quantized>::compile_impl(const dnnl_partition_impl_t *part,
 
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
+    persistent_const_md_hash_ = generate_persistent_constant_md_hash(
+            part->get_ops(),
+            memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
@@ -204,6 +207,9 @@ status_t conv_bwd_data_t::compile_impl(const dnnl_partition_impl_t *part,
 
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
+    persistent_const_md_hash_ = generate_persistent_constant_md_hash(
+            part->get_ops(),
+            memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
@@ -48,6 +48,7 @@ protected:
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
     size_t const_md_hash_ = 0;
+    size_t persistent_const_md_hash_ = 0;
 
 public:
     conv_base_t() {
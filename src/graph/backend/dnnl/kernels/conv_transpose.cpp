@@ -116,6 +116,9 @@ status_t conv_transpose_fwd_t<quantized>::compile_impl(
 
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
+    persistent_const_md_hash_ = generate_persistent_constant_md_hash(
+            part->get_ops(),
+            memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
@@ -185,6 +188,9 @@ status_t conv_transpose_bwd_data_t::compile_impl(
 
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
+    persistent_const_md_hash_ = generate_persistent_constant_md_hash(
+            part->get_ops(),
+            memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
@@ -14,6 +14,11 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+#include <utility>
+
+#include "common/dnnl_thread.hpp"
+
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 
@@ -56,6 +61,88 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+mapped_constant_buffer_t::key_t
+kernel_base_t::encode_persistent_constant_cache_key(
+        const std::vector<tensor_t> &inputs, size_t cache_key) const {
+    // Only the metadata is encoded, so the key is cheap to compute. The
+    // content is verified with hash_constant_inputs().
+    sha256_t sha;
+    sha.update(&cache_key, sizeof(cache_key));
+    for (const auto &in : inputs) {
+        const logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+        if (!ltw.is_constant()) continue;
+
+        const uint64_t id = ltw.id();
+        const uint64_t size = ltw.size();
+        sha.update(&id, sizeof(id));
+        sha.update(&size, sizeof(size));
+    }
+    return sha.finalize();
+}
+
+mapped_constant_buffer_t::key_t kernel_base_t::hash_constant_inputs(
+        const std::vector<tensor_t> &inputs) const {
+    // The constant inputs are split into chunks which are hashed in parallel,
+    // and the digest of the chunk digests is returned
+    constexpr size_t chunk_size = 1024 * 1024;
+    std::vector<std::pair<const uint8_t *, size_t>> chunks;
+    for (const auto &in : inputs) {
+        const logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+        if (!ltw.is_constant()) continue;
+
+        const auto *data = static_cast<const uint8_t *>(in.get_data_handle());
+        const size_t size = ltw.size();
+        // Chunks of different inputs must not be merged, so that the
+        // boundaries between the inputs are part of the digest
+        for (size_t off = 0; off < size; off += chunk_size)
+            chunks.emplace_back(data + off, std::min(chunk_size, size - off));
+        if (size == 0) chunks.emplace_back(data, 0);
+    }
+
+    std::vector<sha256_t::digest_t> digests(chunks.size());
+    parallel_nd(static_cast<dim_t>(chunks.size()), [&](dim_t i) {
+        sha256_t sha;
+        sha.update(chunks[i].first, chunks[i].second);
+        digests[i] = sha.finalize();
+    });
+
+    sha256_t sha;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        const uint64_t size = chunks[i].second;
+        sha.update(&size, sizeof(size));
+        sha.update(digests[i].data(), digests[i].size());
+    }
+    return sha.finalize();
+}
+
+constant_tensor_cache_t::cached_t kernel_base_t::create_constant_buffer(
+        size_t size, const std::vector<tensor_t> &inputs,
+        size_t persistent_md_hash, graph::allocator_t *alc, bool &is_filled) {
+    is_filled = false;
+    if (mapped_constant_buffer_t::is_enabled(p_engine_.get())) {
+        auto buffer = mapped_constant_buffer_t::create(
+                encode_persistent_constant_cache_key(
+                        inputs, persistent_md_hash),
+                hash_constant_inputs(inputs), size, p_engine_.get());
+        if (buffer) {
+            is_filled = buffer->is_filled();
+            return buffer;
+        }
+    }
+    return std::make_shared<dnnl_constant_buffer_t>(size, p_engine_, alc);
+}
+
+void kernel_base_t::commit_constant_buffer(
+        const constant_tensor_cache_t::cached_t &buffer,
+        dnnl::stream &p_stream) const {
+    auto mapped_buffer
+            = std::dynamic_pointer_cast<mapped_constant_buffer_t>(buffer);
+    if (!mapped_buffer) return;
+    // Other processes may map the buffer right after it is committed
+    p_stream.wait();
+    mapped_buffer->commit();
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 }
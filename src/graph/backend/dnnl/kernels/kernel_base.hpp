@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
 // required for dnnl::engine
@@ -106,6 +107,31 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Unlike encode_constant_cache_key(), encodes the ids and sizes of the
+    // constant inputs instead of their addresses, so the key is the same in
+    // all processes which compile the same partition.
+    mapped_constant_buffer_t::key_t encode_persistent_constant_cache_key(
+            const std::vector<tensor_t> &inputs, size_t cache_key) const;
+
+    // Returns a digest of the content of the constant inputs, which is
+    // computed in parallel. It tells whether a shared buffer was computed
+    // from the same constant inputs.
+    mapped_constant_buffer_t::key_t hash_constant_inputs(
+            const std::vector<tensor_t> &inputs) const;
+
+    // Creates the buffer for the constant tensors on a constant cache miss.
+    // The buffer is shared with other processes if this is enabled for the
+    // engine. `is_filled` is set if another process has already computed the
+    // constant tensors into it, so computing them can be skipped.
+    constant_tensor_cache_t::cached_t create_constant_buffer(size_t size,
+            const std::vector<tensor_t> &inputs, size_t persistent_md_hash,
+            graph::allocator_t *alc, bool &is_filled);
+
+    // Makes the computed constant tensors visible to other processes if the
+    // buffer is shared.
+    void commit_constant_buffer(const constant_tensor_cache_t::cached_t &buffer,
+            dnnl::stream &p_stream) const;
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
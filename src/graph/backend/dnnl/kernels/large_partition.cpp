@@ -37,6 +37,10 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     // Directly lower down (1 to 1 mapping)
     BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
 
+    // Merge sibling matmuls with constant weights. Matmuls with consumers
+    // which are fused into them by the passes below are not merged.
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_horizontal_matmuls);
+
     // handle the case that the input is a scalar tensor
     BACKEND_DNNL_ADD_PASS(pipeline, insert_host_scalar);
 
@@ -246,6 +250,9 @@ status_t larger_partition_kernel_t::compile_impl(
 
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
+    persistent_const_md_hash_ = generate_persistent_constant_md_hash(
+            part->get_ops(),
+            memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
@@ -287,9 +294,10 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            bool is_filled = false;
+            c_buffer = create_constant_buffer(
+                    memory_planner_.total_internal_persistent_size(), inputs,
+                    persistent_const_md_hash_, g_alloc_, is_filled);
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
                     c_buffer->data<char>());
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
@@ -297,10 +305,13 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!is_filled) {
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                commit_constant_buffer(c_buffer, p_stream);
             }
 
             c_promise.set_value(c_buffer);
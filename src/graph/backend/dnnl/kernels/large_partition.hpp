@@ -49,6 +49,7 @@ protected:
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
     size_t const_md_hash_ = 0;
+    size_t persistent_const_md_hash_ = 0;
 
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
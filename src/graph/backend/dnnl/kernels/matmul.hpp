@@ -50,6 +50,7 @@ private:
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
     size_t const_md_hash_ = 0;
+    size_t persistent_const_md_hash_ = 0;
 
 public:
     matmul_t() {
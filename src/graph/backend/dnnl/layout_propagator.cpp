@@ -2005,6 +2005,35 @@ status_t layout_propagator_for_gated_mlp(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_split(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // The chunks are taken as sub-memories of the input, which requires a
+    // plain layout on the split axis. Keep both sides plain.
+    value_ptr src_val = op->get_input_value(0);
+    const auto src_md = to_ncx_format(
+            make_dnnl_memory_desc(src_val->get_logical_tensor()));
+    status_t status = insert_reorder_before(op, 0, src_md, p_engine, pd_cache,
+            fpmath, use_block_layout, rewriter);
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to insert reorder before split src");
+    status = fill_layout_info(op->get_input_value(0), src_md);
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for split src");
+
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        value_ptr dst_val = op->get_output_value(i);
+        const logical_tensor_t &dst_lt = dst_val->get_logical_tensor();
+        if (!ltw(dst_lt).is_any()) continue;
+        status = fill_layout_info(
+                dst_val, to_ncx_format(make_dnnl_memory_desc(dst_lt)));
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for split dst");
+    }
+    return status;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
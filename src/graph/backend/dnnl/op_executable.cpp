@@ -79,6 +79,7 @@ executable_creator_func op_func_t::get_executable_creator(op_kind_t kind) {
             {_dropout, dummy_executable_creator},
             {_gated_mlp, executable_creator<gated_mlp_executable_t>},
             {_sdpa_bwd, executable_creator<sdpa_bwd_executable_t>},
+            {_split, executable_creator<split_executable_t>},
     };
 
     if (_map.count(kind) == 0) {
@@ -144,6 +145,7 @@ arg_indices_getter_func op_func_t::get_arg_indices_getter(op_kind_t kind) {
             {_dropout, dummy_arg_indices_getter},
             {_gated_mlp, gated_mlp_executable_t::get_arg_indices},
             {_sdpa_bwd, sdpa_bwd_executable_t::get_arg_indices},
+            {_split, split_executable_t::get_arg_indices},
     };
 
     if (_map.count(kind) == 0) {
@@ -207,6 +209,7 @@ layout_propagator_func op_func_t::get_layout_propagator(op_kind_t kind) {
             {_identity, layout_propagator_for_identity},
             {_gated_mlp, layout_propagator_for_gated_mlp},
             {_sdpa_bwd, layout_propagator_for_sdpa_bwd},
+            {_split, layout_propagator_for_split},
     };
 
     if (_map.count(kind) == 0) {
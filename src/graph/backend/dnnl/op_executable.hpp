@@ -38,6 +38,7 @@
 #include "graph/backend/dnnl/executables/sdpa.hpp"
 #include "graph/backend/dnnl/executables/shuffle.hpp"
 #include "graph/backend/dnnl/executables/softmax.hpp"
+#include "graph/backend/dnnl/executables/split.hpp"
 #include "graph/backend/dnnl/executables/sum.hpp"
 
 #include "graph/backend/dnnl/layout_propagator.hpp"
@@ -46,6 +46,7 @@ bool has_scratchpad(const op_t *op) {
             op_kind::_reshape,
             op_kind::_gen_index,
             op_kind::_mask,
+            op_kind::_split,
     };
 
     // the following ops may have scratchpad output if output size > 1
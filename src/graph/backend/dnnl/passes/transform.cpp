@@ -33,6 +33,7 @@
 #include "graph/interface/shape_infer.hpp"
 #include "graph/utils/utils.hpp"
 
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/fusion_info.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/insert_ops.hpp"
@@ -4953,6 +4954,202 @@ status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_horizontal_matmuls(std::shared_ptr<subgraph_t> &sg) {
+    // The concatenated weights are only computed once when they can be kept
+    // in the constant tensor cache. Otherwise, the concat would re-read all
+    // the weights on every execution, which costs more than it saves.
+    if (!is_constant_cache_enabled(*sg->p_engine_)) return status::success;
+
+    const auto get_bool_attr = [](const op_t *op, op_attr_t attr) {
+        return op->has_attr(attr) && op->get_attr<bool>(attr);
+    };
+
+    // The ops which later passes may fuse into the matmul producing their
+    // input, e.g. as post-ops, bias, typecast, or dst scales and zero points.
+    // The wide matmul only has the split as its consumer, so these would no
+    // longer be fused.
+    const std::set<op_kind_t> fusible_consumer_kinds {op_kind::_eltwise,
+            op_kind::_binary, op_kind::_reorder, op_kind::_mul_scales,
+            op_kind::_add_zps, op_kind::_dropout, op_kind::_transpose,
+            op_kind::_reshape};
+
+    // Whether the constant input `idx` of the matmul has no producer and a
+    // known shape.
+    const auto is_constant_input = [](const op_ptr &op, size_t idx) {
+        const auto val = op->get_input_value(idx);
+        if (val->has_producer()) return false;
+        const logical_tensor_t &lt = val->get_logical_tensor();
+        return ltw(lt).is_constant() && !ltw(lt).is_shape_unknown()
+                && !ltw(lt).has_zero_dim();
+    };
+
+    // A matmul can be fused with its siblings only if it's a plain matmul
+    // whose weight and optional bias are constant inputs of the subgraph with
+    // known shapes, and whose output is not consumed by an op which would be
+    // fused into it.
+    const auto is_candidate = [&](const op_ptr &op) {
+        if (op->get_kind() != op_kind::_matmul || op->num_inputs() < 2
+                || op->num_inputs() > 3 || op->has_attr(op_attr::fusion_info))
+            return false;
+        if (!is_constant_input(op, 1)
+                || ltw(op->get_input_logical_tensor(1)).ndims() < 2)
+            return false;
+        if (op->num_inputs() == 3) {
+            // The bias is concatenated along N, so it must not be broadcast
+            // in N.
+            if (!is_constant_input(op, 2)) return false;
+            const auto wei_dims = ltw(op->get_input_logical_tensor(1)).vdims();
+            const bool trans_b = op->has_attr(op_attr::transpose_b)
+                    && op->get_attr<bool>(op_attr::transpose_b);
+            const dim_t n = wei_dims[wei_dims.size() - (trans_b ? 2 : 1)];
+            const auto bias_dims
+                    = ltw(op->get_input_logical_tensor(2)).vdims();
+            if (bias_dims.back() != n) return false;
+            for (size_t i = 0; i + 1 < bias_dims.size(); ++i)
+                if (bias_dims[i] != 1) return false;
+        }
+        for (const auto &consumer : op->get_output_value(0)->get_consumers())
+            if (fusible_consumer_kinds.count(consumer.get_op().get_kind()))
+                return false;
+        return true;
+    };
+
+    // Group the candidates by the shared src value, the bias ranks and data
+    // types, and everything except the N dimension of the weights. The N
+    // dimension is the last one, or the second to last one if the weights are
+    // transposed.
+    using group_key_t = std::tuple<value_t *, bool, bool, data_type_t,
+            data_type_t, std::vector<dim_t>, int32_t, data_type_t>;
+    std::map<group_key_t, std::vector<op_ptr>> groups;
+    std::vector<group_key_t> group_order;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (!is_candidate(cur_op)) continue;
+
+        const bool trans_b = get_bool_attr(cur_op.get(), op_attr::transpose_b);
+        const logical_tensor_t &wei_lt = cur_op->get_input_logical_tensor(1);
+        std::vector<dim_t> wei_dims = ltw(wei_lt).vdims();
+        wei_dims[wei_dims.size() - (trans_b ? 2 : 1)] = DNNL_GRAPH_UNKNOWN_DIM;
+
+        int32_t bias_ndims = 0;
+        data_type_t bias_dt = graph::data_type::undef;
+        if (cur_op->num_inputs() == 3) {
+            const logical_tensor_t &bias_lt
+                    = cur_op->get_input_logical_tensor(2);
+            bias_ndims = bias_lt.ndims;
+            bias_dt = bias_lt.data_type;
+        }
+
+        const logical_tensor_t &dst_lt = cur_op->get_output_logical_tensor(0);
+        group_key_t key {cur_op->get_input_value(0).get(),
+                get_bool_attr(cur_op.get(), op_attr::transpose_a), trans_b,
+                wei_lt.data_type, dst_lt.data_type, wei_dims, bias_ndims,
+                bias_dt};
+        if (groups.count(key) == 0) group_order.emplace_back(key);
+        groups[key].emplace_back(cur_op);
+    }
+
+    subgraph_rewriter_t rewriter(sg);
+    for (const auto &key : group_order) {
+        const auto &siblings = groups.at(key);
+        if (siblings.size() < 2) continue;
+
+        const bool trans_b = std::get<2>(key);
+        const int64_t wei_axis = trans_b ? -2 : -1;
+        const op_ptr &first = siblings.front();
+
+        // concat the weights along N. All inputs are constant, so the concat
+        // is folded into the constant tensor cache by constant propagation.
+        op_ptr concat_op = std::make_shared<op_t>(op_kind::_concat);
+        concat_op->set_attr<int64_t>(op_attr::axis, wei_axis);
+        std::vector<int64_t> sizes;
+        std::vector<dim_t> wide_wei_dims
+                = ltw(first->get_input_logical_tensor(1)).vdims();
+        const size_t n_idx = wide_wei_dims.size() - (trans_b ? 2 : 1);
+        wide_wei_dims[n_idx] = 0;
+        for (size_t i = 0; i < siblings.size(); ++i) {
+            auto wei_val = siblings[i]->get_input_value(1);
+            const dim_t n = ltw(wei_val->get_logical_tensor()).vdims()[n_idx];
+            sizes.emplace_back(n);
+            wide_wei_dims[n_idx] += n;
+            wei_val->remove_consumer(*siblings[i], 1);
+            concat_op->connect_input(i, wei_val);
+        }
+        logical_tensor_t wide_wei_lt = empty_logical_tensor_with_default_id();
+        auto wide_wei_val = std::make_shared<value_t>(
+                *concat_op, 0, wide_wei_lt, true);
+        wide_wei_val->set_data_type(std::get<3>(key));
+        wide_wei_val->set_dims(wide_wei_dims);
+        wide_wei_val->set_property(property_type::constant);
+        concat_op->add_output(wide_wei_val);
+        insert_empty_scratchpad(concat_op);
+
+        // the biases are concatenated along N the same way
+        op_ptr bias_concat_op;
+        if (std::get<6>(key) > 0) {
+            bias_concat_op = std::make_shared<op_t>(op_kind::_concat);
+            bias_concat_op->set_attr<int64_t>(op_attr::axis, -1);
+            std::vector<dim_t> wide_bias_dims
+                    = ltw(first->get_input_logical_tensor(2)).vdims();
+            wide_bias_dims.back() = wide_wei_dims[n_idx];
+            for (size_t i = 0; i < siblings.size(); ++i) {
+                auto bias_val = siblings[i]->get_input_value(2);
+                bias_val->remove_consumer(*siblings[i], 2);
+                bias_concat_op->connect_input(i, bias_val);
+            }
+            logical_tensor_t wide_bias_lt
+                    = empty_logical_tensor_with_default_id();
+            auto wide_bias_val = std::make_shared<value_t>(
+                    *bias_concat_op, 0, wide_bias_lt, true);
+            wide_bias_val->set_data_type(std::get<7>(key));
+            wide_bias_val->set_dims(wide_bias_dims);
+            wide_bias_val->set_property(property_type::constant);
+            bias_concat_op->add_output(wide_bias_val);
+            insert_empty_scratchpad(bias_concat_op);
+        }
+
+        // one wide matmul reading the shared src once
+        op_ptr matmul_op = std::make_shared<op_t>(op_kind::_matmul);
+        matmul_op->merge_attributes(first->get_attributes());
+        auto src_val = first->get_input_value(0);
+        for (const auto &sibling : siblings)
+            src_val->remove_consumer(*sibling, 0);
+        matmul_op->connect_input(0, src_val);
+        matmul_op->connect_input(1, wide_wei_val);
+        if (bias_concat_op)
+            matmul_op->connect_input(2, bias_concat_op->get_output_value(0));
+        logical_tensor_t wide_dst_lt = empty_logical_tensor_with_default_id();
+        auto wide_dst_val = std::make_shared<value_t>(
+                *matmul_op, 0, wide_dst_lt, true);
+        wide_dst_val->set_data_type(std::get<4>(key));
+        const logical_tensor_t &dst_lt = first->get_output_logical_tensor(0);
+        if (!ltw(dst_lt).is_shape_unknown()) {
+            std::vector<dim_t> wide_dst_dims = ltw(dst_lt).vdims();
+            wide_dst_dims.back() = wide_wei_dims[n_idx];
+            wide_dst_val->set_dims(wide_dst_dims);
+        }
+        matmul_op->add_output(wide_dst_val);
+        insert_empty_scratchpad(matmul_op);
+
+        // split the wide dst back into the original outputs
+        op_ptr split_op = std::make_shared<op_t>(op_kind::_split);
+        split_op->set_attr<int64_t>(op_attr::axis, -1);
+        split_op->set_attr<std::vector<int64_t>>(op_attr::sizes, sizes);
+        split_op->connect_input(0, wide_dst_val);
+        for (size_t i = 0; i < siblings.size(); ++i) {
+            split_op->add_output(siblings[i]->get_output_value(0));
+            rewriter.to_remove(siblings[i]);
+        }
+
+        rewriter.to_insert(concat_op);
+        if (bias_concat_op) rewriter.to_insert(bias_concat_op);
+        rewriter.to_insert(matmul_op);
+        rewriter.to_insert(split_op);
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
 // Fuses a backward SDPA subgraph into a single _sdpa_bwd op.
 //
 // Pattern (all optional nodes indicated with []):
@@ -307,6 +307,24 @@ status_t fuse_sdpa_bwd(std::shared_ptr<subgraph_t> &sg);
 /// This pass will transform the gated mlp subgraph into a _gated_mlp op.
 status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will fuse sibling matmuls sharing the same src into one wider
+/// matmul. The constant weights are concatenated along N and the dst of the
+/// wider matmul is split back into the original outputs:
+///
+///          src                        src   concat(w0, w1)
+///        /     \                        \   /
+///   matmul(w0) matmul(w1)     ---->       matmul
+///       |          |                        |
+///     dst0       dst1                     split
+///                                       |     |
+///                                     dst0   dst1
+///
+/// Constant biases are concatenated along N as well. Matmuls whose outputs
+/// are consumed by ops which would be fused into them, e.g. post-ops, are
+/// left alone. It only applies when the constant tensor cache is enabled so
+/// that the concat is computed once.
+status_t fuse_horizontal_matmuls(std::shared_ptr<subgraph_t> &sg);
+
 /// This pass will decompose the softmax with stats output into a normal softmax
 /// without stats output and some small ops to compute the stats.
 /// The main reason for this pass is that the current implementation
@@ -271,6 +271,7 @@ const op_kind_t _identity = 1071;
 const op_kind_t _dropout = 1072;
 const op_kind_t _gated_mlp = 1073;
 const op_kind_t _sdpa_bwd = 1074;
+const op_kind_t _split = 1075;
 } // namespace op_kind
 
 using op_attr_t = typename std::underlying_type<dnnl_graph_op_attr_t>::type;
@@ -434,6 +435,8 @@ using graph_t = dnnl_graph_graph;
 using op_t = dnnl_graph_op;
 using partition_t = dnnl_graph_partition;
 using compiled_partition_t = dnnl_graph_compiled_partition;
+using memory_plan_t = dnnl_graph_memory_plan;
+using schedule_t = dnnl_graph_schedule;
 using tensor_t = dnnl_graph_tensor;
 
 // oneDNN common objects
@@ -15,11 +15,18 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "oneapi/dnnl/dnnl_common.h"
+
 #include "common/engine.hpp"
 #include "common/utils.hpp"
 
@@ -41,6 +48,11 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 namespace std {
@@ -287,6 +299,180 @@ void constant_tensor_cache_t::evict(size_t n) {
     }
 }
 
+// The variable is read on each query, which only happens on constant cache
+// misses. getenv_string_user() is not used as it lowercases the value.
+static std::string get_constant_tensor_cache_dir() {
+    char dir[4096];
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        const std::string name
+                = std::string(prefix) + "GRAPH_CONSTANT_TENSOR_CACHE_DIR";
+        if (impl::getenv(name.c_str(), dir, sizeof(dir)) > 0) return dir;
+    }
+    return std::string();
+}
+
+bool mapped_constant_buffer_t::is_enabled(const impl::engine_t *eng) {
+#ifdef _WIN32
+    UNUSED(eng);
+    return false;
+#else
+    return eng->kind() == impl::engine_kind::cpu
+            && impl::is_native_runtime(eng->runtime_kind())
+            && !get_constant_tensor_cache_dir().empty();
+#endif
+}
+
+#ifndef _WIN32
+namespace {
+
+// The header of a file backing a mapped constant buffer. The content follows
+// at the next page boundary.
+struct mapped_file_header_t {
+    char magic[16];
+    uint8_t digest[32];
+    uint64_t size;
+    // The digest of the constant inputs the content was computed from
+    uint8_t content_digest[32];
+};
+
+mapped_file_header_t make_mapped_file_header(const sha256_t::digest_t &digest,
+        const sha256_t::digest_t &content_digest, size_t size) {
+    mapped_file_header_t header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "onednn_graph_ct2", sizeof(header.magic));
+    std::memcpy(header.digest, digest.data(), sizeof(header.digest));
+    header.size = size;
+    std::memcpy(header.content_digest, content_digest.data(),
+            sizeof(header.content_digest));
+    return header;
+}
+
+size_t get_mapped_file_header_size() {
+    const long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+}
+
+// Another user may have created the file, e.g. in /dev/shm, or the name may
+// belong to other content.
+bool is_trusted_mapped_file(int fd, const mapped_file_header_t &expected,
+        size_t file_size, mapped_file_header_t &header) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_uid != geteuid()
+            || (st.st_mode & (S_IWGRP | S_IWOTH)) != 0
+            || static_cast<size_t>(st.st_size) != file_size)
+        return false;
+
+    if (pread(fd, &header, sizeof(header), 0)
+            != static_cast<ssize_t>(sizeof(header)))
+        return false;
+    return std::memcmp(&header, &expected,
+                   offsetof(mapped_file_header_t, content_digest))
+            == 0;
+}
+
+} // namespace
+#endif
+
+std::shared_ptr<mapped_constant_buffer_t> mapped_constant_buffer_t::create(
+        const key_t &key, const key_t &content_digest, size_t size,
+        impl::engine_t *eng) {
+    if (size == 0 || !is_enabled(eng)) return nullptr;
+#ifdef _WIN32
+    UNUSED(key);
+    UNUSED(content_digest);
+    return nullptr;
+#else
+    // The content depends on the library build, e.g. on the layouts chosen by
+    // the implementations
+    sha256_t sha;
+    sha.update(key.data(), key.size());
+    sha.update(std::string(dnnl_version()->hash));
+    const auto digest = sha.finalize();
+
+    const std::string path = get_constant_tensor_cache_dir()
+            + "/onednn_graph_constant_" + sha256_t::to_hex(digest) + "_"
+            + std::to_string(size);
+    const auto header = make_mapped_file_header(digest, content_digest, size);
+    const size_t offset = get_mapped_file_header_size();
+
+    // Map the content committed by another process if it exists
+    int fd = open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd >= 0) {
+        mapped_file_header_t file_header;
+        const bool trusted = is_trusted_mapped_file(
+                fd, header, offset + size, file_header);
+        // The file was computed from other constant inputs of the same
+        // shapes, e.g. from an older version of the model. It is replaced
+        // with a new one on commit.
+        const bool stale = trusted
+                && std::memcmp(file_header.content_digest,
+                           header.content_digest,
+                           sizeof(header.content_digest))
+                        != 0;
+        void *data = MAP_FAILED;
+        if (trusted && !stale)
+            data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd,
+                    static_cast<off_t>(offset));
+        close(fd);
+        if (!stale) {
+            if (data == MAP_FAILED) return nullptr;
+            return std::shared_ptr<mapped_constant_buffer_t>(
+                    new mapped_constant_buffer_t(
+                            data, size, eng, path, "", true));
+        }
+    } else if (errno != ENOENT) {
+        // E.g. the path is a symbolic link
+        return nullptr;
+    }
+
+    // Otherwise the content is computed into a private file which is renamed
+    // on commit. The counter separates files of the same key created by
+    // different kernels of this process.
+    static std::atomic<size_t> counter {0};
+    const std::string tmp_path = path + "." + std::to_string(getpid()) + "."
+            + std::to_string(counter++) + ".tmp";
+    fd = open(tmp_path.c_str(),
+            O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (fd < 0) return nullptr;
+
+    // Reserve the space upfront, since writing to a mapping of a sparse file
+    // on a full file system raises SIGBUS
+    void *data = MAP_FAILED;
+    if (posix_fallocate(fd, 0, static_cast<off_t>(offset + size)) == 0
+            && pwrite(fd, &header, sizeof(header), 0)
+                    == static_cast<ssize_t>(sizeof(header)))
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                static_cast<off_t>(offset));
+    close(fd);
+    if (data == MAP_FAILED) {
+        unlink(tmp_path.c_str());
+        return nullptr;
+    }
+    return std::shared_ptr<mapped_constant_buffer_t>(
+            new mapped_constant_buffer_t(
+                    data, size, eng, path, tmp_path, false));
+#endif
+}
+
+mapped_constant_buffer_t::~mapped_constant_buffer_t() {
+#ifndef _WIN32
+    munmap(data_, size_);
+    // The content was not completely computed
+    if (!tmp_path_.empty()) unlink(tmp_path_.c_str());
+#endif
+}
+
+void mapped_constant_buffer_t::commit() {
+#ifndef _WIN32
+    if (tmp_path_.empty()) return;
+    // rename() replaces the file atomically, so other processes either find
+    // no file or the complete content
+    if (rename(tmp_path_.c_str(), path_.c_str()) != 0)
+        unlink(tmp_path_.c_str());
+    tmp_path_.clear();
+#endif
+}
+
 // copy from src/common/engine.cpp
 static std::unique_ptr<impl::engine_factory_t> get_engine_factory(
         impl::engine_kind_t kind, impl::runtime_kind_t runtime_kind) {
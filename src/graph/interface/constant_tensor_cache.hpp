@@ -21,6 +21,7 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 
@@ -30,6 +31,7 @@
 
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/c_types_map.hpp"
+#include "common/sha256.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -53,7 +55,7 @@ public:
     }
 
     virtual ~constant_buffer_t() {
-        free_func_(data_, eng_, alc_);
+        if (free_func_) free_func_(data_, eng_, alc_);
         eng_->release();
     }
 
@@ -75,6 +77,17 @@ public:
     virtual void notify_evict() {}
 
 protected:
+    // Wraps memory which is owned and released by the derived class
+    constant_buffer_t(void *data, size_t size, impl::engine_t *eng)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(nullptr)
+        , malloc_func_(nullptr)
+        , free_func_(nullptr) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -85,6 +98,61 @@ private:
     free_func_t free_func_;
 };
 
+// A constant buffer backed by a file which is mapped into memory. The file is
+// named after a key which does not depend on the process, so the processes
+// that compute the same constant tensors share the pages of one file, and a
+// restarted process finds the tensors computed by its previous run. The files
+// are placed into the directory given by the
+// ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR environment variable, e.g. /dev/shm
+// for sharing through shared memory only. Only CPU engines with native
+// runtimes are supported.
+//
+// The directory may be writable by other users, so an existing file is only
+// mapped if it is a regular file owned by the effective user, is not writable
+// by the group and others, and its header holds the full digest of the key.
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    using key_t = sha256_t::digest_t;
+
+    // `key` identifies the file, e.g. by the partition and the metadata of
+    // the constant inputs. `content_digest` is a digest of the constant
+    // inputs: a file computed from other inputs is not mapped, but replaced
+    // on commit.
+    //
+    // Returns nullptr if mapping is disabled, not supported for the engine,
+    // or fails, or if the existing file is not trusted. In this case the
+    // regular constant buffer should be used.
+    static std::shared_ptr<mapped_constant_buffer_t> create(const key_t &key,
+            const key_t &content_digest, size_t size, impl::engine_t *eng);
+
+    ~mapped_constant_buffer_t() override;
+
+    // Whether the buffer already contains the constant tensors, which were
+    // computed by this or another process. Such a buffer is read-only.
+    bool is_filled() const { return is_filled_; }
+
+    // Publishes the content of a buffer which was not filled, so that other
+    // processes can map it. Must be called after the constant tensors are
+    // computed.
+    void commit();
+
+    static bool is_enabled(const impl::engine_t *eng);
+
+private:
+    mapped_constant_buffer_t(void *data, size_t size, impl::engine_t *eng,
+            const std::string &path, const std::string &tmp_path,
+            bool is_filled)
+        : constant_buffer_t(data, size, eng)
+        , path_(path)
+        , tmp_path_(tmp_path)
+        , is_filled_(is_filled) {}
+
+    std::string path_;
+    // The file the content is written to before it is committed
+    std::string tmp_path_;
+    bool is_filled_;
+};
+
 struct constant_tensor_cache_t {
     using key_t = size_t;
     using cached_t = std::shared_ptr<constant_buffer_t>;
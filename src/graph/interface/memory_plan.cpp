@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <map>
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#include "common/utils.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/memory_plan.hpp"
+#include "graph/interface/partition.hpp"
+
+#include "graph/utils/utils.hpp"
+
+using namespace dnnl::impl::graph;
+
+namespace {
+
+// A free list of buffers. Only sizes are tracked, the real memory is provided
+// by users as one buffer once the plan is finalized.
+class buffer_pool_t {
+public:
+    // Returns the id of a free buffer which can hold the requested size.
+    // Prefers the smallest free buffer which is large enough, then the
+    // largest free buffer which can be grown, and creates a new one
+    // otherwise.
+    size_t request(size_t size) {
+        auto it = free_.lower_bound(size);
+        if (it == free_.end() && !free_.empty()) --it;
+        if (it == free_.end()) {
+            sizes_.push_back(size);
+            return sizes_.size() - 1;
+        }
+
+        const size_t id = it->second;
+        sizes_[id] = std::max(sizes_[id], size);
+        free_.erase(it);
+        return id;
+    }
+
+    void grow(size_t id, size_t size) {
+        sizes_[id] = std::max(sizes_[id], size);
+    }
+
+    void release(size_t id) { free_.insert({sizes_[id], id}); }
+
+    const std::vector<size_t> &sizes() const { return sizes_; }
+
+private:
+    // size -> buffer id
+    std::multimap<size_t, size_t> free_;
+    std::vector<size_t> sizes_;
+};
+
+} // namespace
+
+status_t dnnl_graph_memory_plan::init(
+        const std::vector<const compiled_partition_t *> &compiled_partitions,
+        const std::vector<size_t> *live_outs) {
+    using ltw = logical_tensor_wrapper_t;
+    const size_t nsteps = compiled_partitions.size();
+
+    // tensor id -> index of the producing and the last consuming partition
+    std::unordered_map<size_t, size_t> producer, last_use;
+    std::unordered_map<size_t, size_t> tensor_size;
+    for (size_t step = 0; step < nsteps; ++step) {
+        const auto *cp = compiled_partitions[step];
+        for (const auto &in : cp->get_inputs()) {
+            auto it = producer.find(in.id);
+            if (it != producer.end()) last_use[in.id] = step;
+        }
+        for (const auto &out : cp->get_outputs()) {
+            // The size of a tensor is needed to plan it
+            if (ltw(out).is_shape_unknown() || ltw(out).is_any())
+                return status::invalid_arguments;
+            if (!producer.emplace(out.id, step).second)
+                return status::invalid_arguments;
+            tensor_size[out.id] = ltw(out).size();
+        }
+    }
+
+    // Consumers which appear before the producer mean that the given order
+    // is not a valid execution order
+    for (size_t step = 0; step < nsteps; ++step) {
+        for (const auto &in : compiled_partitions[step]->get_inputs()) {
+            auto it = producer.find(in.id);
+            if (it != producer.end() && it->second > step)
+                return status::invalid_arguments;
+        }
+    }
+
+    // Live-out tensors are never released. Without an explicit list, the
+    // tensors which are not consumed are the live-out ones. Otherwise, the
+    // buffer of a tensor which is not consumed is released right after the
+    // partition which produces it.
+    if (live_outs) {
+        for (const size_t id : *live_outs) {
+            if (producer.count(id) == 0) return status::invalid_arguments;
+            last_use[id] = nsteps;
+        }
+        for (const auto &tensor_producer : producer)
+            last_use.emplace(tensor_producer.first, tensor_producer.second);
+    }
+
+    buffer_pool_t pool;
+    // tensor id -> buffer id
+    std::unordered_map<size_t, size_t> buffer_of;
+    for (size_t step = 0; step < nsteps; ++step) {
+        const auto *cp = compiled_partitions[step];
+
+        // An output of an in-place pair takes over the buffer of its input if
+        // this partition is the last consumer of the input
+        std::unordered_map<size_t, size_t> inplace_inputs;
+        for (const auto &pair : cp->get_inplace_pairs()) {
+            auto it = last_use.find(pair.input_id);
+            if (it == last_use.end() || it->second != step) continue;
+            if (buffer_of.count(pair.output_id)) continue;
+            if (inplace_inputs.count(pair.input_id)) continue;
+            const size_t buffer = buffer_of.at(pair.input_id);
+            pool.grow(buffer, tensor_size.at(pair.output_id));
+            buffer_of[pair.output_id] = buffer;
+            inplace_inputs[pair.input_id] = pair.output_id;
+        }
+
+        for (const auto &out : cp->get_outputs()) {
+            if (buffer_of.count(out.id)) continue;
+            buffer_of[out.id] = pool.request(tensor_size.at(out.id));
+        }
+
+        for (const auto &in : cp->get_inputs()) {
+            auto it = last_use.find(in.id);
+            if (it == last_use.end() || it->second != step) continue;
+            // Release each buffer once even if the tensor is given twice
+            it->second = nsteps;
+            if (inplace_inputs.count(in.id)) continue;
+            pool.release(buffer_of.at(in.id));
+        }
+
+        // Outputs which are neither consumed nor live-out are dead as soon as
+        // the partition is executed
+        for (const auto &out : cp->get_outputs()) {
+            auto it = last_use.find(out.id);
+            if (it == last_use.end() || it->second != step) continue;
+            it->second = nsteps;
+            pool.release(buffer_of.at(out.id));
+        }
+    }
+
+    std::vector<size_t> buffer_offsets;
+    buffer_offsets.reserve(pool.sizes().size());
+    size_ = 0;
+    for (const size_t size : pool.sizes()) {
+        buffer_offsets.push_back(size_);
+        size_ += dnnl::impl::utils::rnd_up(size, alignment_);
+    }
+
+    offsets_.clear();
+    for (const auto &tensor_buffer : buffer_of)
+        offsets_[tensor_buffer.first] = buffer_offsets[tensor_buffer.second];
+
+    return status::success;
+}
+
+status_t dnnl_graph_memory_plan::query_offset(
+        size_t tid, size_t *offset) const {
+    auto it = offsets_.find(tid);
+    if (it == offsets_.end()) return status::invalid_arguments;
+    *offset = it->second;
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_create(memory_plan_t **memory_plan,
+        size_t num_compiled_partitions,
+        const compiled_partition_t **compiled_partitions,
+        size_t num_live_outs, const size_t *live_out_ids) {
+    if (utils::any_null(memory_plan, compiled_partitions))
+        return status::invalid_arguments;
+    if (num_live_outs > 0 && live_out_ids == nullptr)
+        return status::invalid_arguments;
+
+    std::vector<const compiled_partition_t *> cps {
+            compiled_partitions, compiled_partitions + num_compiled_partitions};
+    for (const auto *cp : cps) {
+        if (!cp || !cp->is_initialized()) return status::invalid_arguments;
+    }
+
+    std::vector<size_t> live_outs;
+    if (live_out_ids)
+        live_outs.assign(live_out_ids, live_out_ids + num_live_outs);
+
+    *memory_plan = new memory_plan_t();
+    const status_t ret = (*memory_plan)->init(
+            cps, live_out_ids ? &live_outs : nullptr);
+    if (ret != status::success) {
+        delete *memory_plan;
+        *memory_plan = nullptr;
+    }
+    return ret;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_get_size(
+        const memory_plan_t *memory_plan, size_t *size) {
+    if (utils::any_null(memory_plan, size)) return status::invalid_arguments;
+
+    *size = memory_plan->get_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_query_offset(
+        const memory_plan_t *memory_plan, size_t tid, size_t *offset) {
+    if (utils::any_null(memory_plan, offset)) return status::invalid_arguments;
+
+    return memory_plan->query_offset(tid, offset);
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_destroy(memory_plan_t *memory_plan) {
+    delete memory_plan;
+    return status::success;
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_MEMORY_PLAN_HPP
+#define GRAPH_INTERFACE_MEMORY_PLAN_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+
+// The memory plan assigns the tensors which connect compiled partitions, and
+// the live-out ones, to offsets in a single buffer. It complements the memory
+// planning done by backends inside each compiled partition: the boundary
+// tensors are allocated by users, so without a plan each of them needs its own
+// buffer even if their lifetimes never overlap. The internal temporaries of the
+// compiled partitions are not part of the plan.
+//
+// Buffers are reused in the same way as inside a partition: the partitions are
+// visited in execution order, each output requests a buffer from a free list
+// and the buffers of inputs are released after their last consumer.
+struct dnnl_graph_memory_plan {
+public:
+    dnnl_graph_memory_plan() = default;
+
+    ~dnnl_graph_memory_plan() = default;
+
+    // If `live_outs` is nullptr, the tensors which are not consumed by any
+    // compiled partition are the live-out ones.
+    dnnl::impl::graph::status_t init(
+            const std::vector<const dnnl::impl::graph::compiled_partition_t *>
+                    &compiled_partitions,
+            const std::vector<size_t> *live_outs);
+
+    size_t get_size() const { return size_; }
+
+    dnnl::impl::graph::status_t query_offset(size_t tid, size_t *offset) const;
+
+private:
+    // All offsets are aligned to this value
+    static constexpr size_t alignment_ = 64;
+
+    size_t size_ = 0;
+
+    // tensor id -> offset in the buffer
+    std::unordered_map<size_t, size_t> offsets_;
+};
+
+#endif
@@ -548,6 +548,7 @@ public:
             CASE(_dropout);
             CASE(_gated_mlp);
             CASE(_sdpa_bwd);
+            CASE(_split);
             default: return "undefined_op";
         }
 #undef CASE
@@ -2431,6 +2431,20 @@ DNNL_GRAPH_OP_SCHEMA(_sdpa_bwd, 1,
                 .set_attr(op_attr::vs_acc_mode, true, attribute_kind::s)
                 .set_shape_inference_function(infer_dnnl_sdpa_bwd_output_shape))
 
+// Splits the input along `axis` into consecutive chunks whose extents are given
+// by `sizes`. Used to separate the outputs of horizontally fused matmuls.
+DNNL_GRAPH_OP_SCHEMA(_split, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_outputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_outputs(std::set<size_t>({1, 64}))
+                .set_input(0, "input")
+                .set_output(0, "output")
+                .set_attr(op_attr::axis, true, attribute_kind::i)
+                .set_attr(op_attr::sizes, true, attribute_kind::is)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                .set_shape_inference_function(infer_dnnl_split_output_shape))
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
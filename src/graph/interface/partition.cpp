@@ -39,6 +39,7 @@
 #include "graph/interface/op_schema.hpp"
 #include "graph/interface/partition.hpp"
 #include "graph/interface/partition_cache.hpp"
+#include "graph/interface/shape_specializing_partition.hpp"
 
 #ifdef DNNL_WITH_SYCL
 #include "oneapi/dnnl/dnnl_sycl.hpp"
@@ -656,6 +657,26 @@ status_t dnnl_graph_partition::compile(
         std::vector<const logical_tensor_t *> &outputs,
         const engine_t *aengine) const {
     namespace partition_hashing = partition_hashing;
+
+    // Inputs with unknown dimensions produce a shape-specializing compiled
+    // partition which is specialized for the concrete shapes on execution.
+    if (shape_specializing_compiled_partition_impl_t::is_applicable(
+                *this, inputs, outputs)) {
+        if (!aengine || aengine->kind() != pimpl_->get_engine_kind())
+            return status::invalid_arguments;
+
+        std::vector<logical_tensor_t> ins, outs;
+        for (const auto *in : inputs)
+            ins.push_back(*in);
+        for (const auto *out : outputs)
+            outs.push_back(*out);
+        compiled_partition.first->init(
+                std::make_shared<shape_specializing_compiled_partition_impl_t>(
+                        *aengine, *this, ins, outs));
+        compiled_partition.second = cache_state_t::miss;
+        return status::success;
+    }
+
     auto &global_compiled_partition_cache = compiled_partition_cache();
     partition_hashing::key_t key(this, aengine, inputs, outputs);
 
@@ -693,6 +714,8 @@ status_t dnnl_graph_partition::compile(
 status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs) const {
+    // Compiled partitions are not recorded.
+    if (astream && astream->is_recording()) return status::invalid_arguments;
     if (astream->engine()->kind() == engine_kind::gpu) {
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_SYCL
         return execute_sycl(astream, inputs, outputs, {}, nullptr);
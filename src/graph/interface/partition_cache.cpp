@@ -19,10 +19,13 @@
 #include <vector>
 #include <unordered_map>
 
+#include "graph/interface/backend.hpp"
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/partition.hpp"
 #include "graph/interface/partition_cache.hpp"
 
+#include "graph/utils/debug.hpp"
+
 #include "common/rw_mutex.hpp"
 
 #ifdef _WIN32
@@ -49,6 +52,16 @@ const partition_t *compiled_partition_cache_t::get_partition(const key_t &key) {
     return result.value != nullptr ? &(result.value->src_partition()) : nullptr;
 }
 
+std::pair<std::string, std::string> compiled_partition_cache_t::get_stats_name(
+        const key_t &key, const result_t *result) {
+    UNUSED(key);
+    if (!result || result->is_empty()) return {};
+    const partition_t &p = result->value->src_partition();
+    const backend_t *backend = p.get_assigned_backend();
+    return {utils::partition_kind2str(p.get_kind()),
+            backend ? backend->get_name() : std::string()};
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -73,3 +86,19 @@ dnnl::impl::graph::status_t dnnl_graph_set_compiled_partition_cache_capacity(
 #endif
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t dnnl_graph_get_compiled_partition_cache_stats(
+        int *nstats, dnnl_cache_stats_t *stats) {
+    std::vector<dnnl::impl::utils::cache_stats_t> s;
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    s = dnnl::impl::graph::compiled_partition_cache().get_stats();
+#endif
+    return dnnl::impl::utils::copy_cache_stats(s, nstats, stats);
+}
+
+dnnl::impl::graph::status_t dnnl_graph_reset_compiled_partition_cache_stats() {
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    dnnl::impl::graph::compiled_partition_cache().reset_stats();
+#endif
+    return dnnl::impl::graph::status::success;
+}
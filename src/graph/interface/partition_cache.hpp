@@ -19,7 +19,9 @@
 
 #include <future>
 #include <memory>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -58,6 +60,11 @@ struct compiled_partition_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    std::vector<utils::cache_stats_t> get_stats() const {
+        return cache_.get_stats();
+    }
+    void reset_stats() { cache_.reset_stats(); }
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
         // Always try to fetch the compiled_partition from the cache. There's no
@@ -69,10 +76,14 @@ struct compiled_partition_cache_t {
     const partition_t *get_partition(const key_t &key);
 
 private:
+    // Groups compiled partitions by partition kind and backend.
+    static std::pair<std::string, std::string> get_stats_name(
+            const key_t &key, const result_t *result);
+
     // No need to set key_merge here since update_entry function is not need in
     // partition cache
     utils::lru_cache_t<key_t, compiled_partition_t, result_t,
-            /* key_merge */ nullptr>
+            /* key_merge */ nullptr, get_stats_name>
             cache_;
 };
 
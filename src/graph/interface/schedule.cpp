@@ -0,0 +1,412 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/op.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/schedule.hpp"
+#include "graph/interface/tensor.hpp"
+
+using namespace dnnl::impl::graph;
+
+namespace {
+
+// Work below which one more thread is not expected to speed up a compiled
+// partition. Small partitions are estimated to use only a part of the threads
+// of a stream, which is what makes running them side by side profitable.
+constexpr double min_work_per_thread = 1 << 15;
+
+// Estimated number of multiply-adds of compute-bound ops, 0 for other ops or
+// when the shapes are not known.
+double compute_cost(const op_t &op) {
+    using ltw = logical_tensor_wrapper_t;
+    if (op.num_inputs() < 2 || op.num_outputs() < 1) return 0;
+
+    const auto src = op.get_input_value(0)->get_logical_tensor();
+    const auto wei = op.get_input_value(1)->get_logical_tensor();
+    const auto dst = op.get_output_value(0)->get_logical_tensor();
+    if (ltw(src).is_shape_unknown() || ltw(wei).is_shape_unknown()
+            || ltw(dst).is_shape_unknown())
+        return 0;
+
+    const auto dst_dims = ltw(dst).vdims();
+    const double dst_nelems = static_cast<double>(ltw(dst).nelems());
+    switch (op.get_kind()) {
+        case op_kind::MatMul: {
+            const auto src_dims = ltw(src).vdims();
+            if (src_dims.empty()) return 0;
+            const bool transpose_a = op.has_attr(op_attr::transpose_a)
+                    && op.get_attr<bool>(op_attr::transpose_a);
+            const size_t nd = src_dims.size();
+            const dim_t K = (transpose_a && nd > 1) ? src_dims[nd - 2]
+                                                    : src_dims[nd - 1];
+            return dst_nelems * static_cast<double>(K);
+        }
+        case op_kind::Convolution: {
+            if (dst_dims.size() < 3) return 0;
+            const bool ncx = op.has_attr(op_attr::data_format)
+                    && op.get_attr<std::string>(op_attr::data_format) == "NCX";
+            const dim_t oc = ncx ? dst_dims[1] : dst_dims.back();
+            if (oc <= 0) return 0;
+            // Each output point reads IC / groups * kernel size weights
+            return dst_nelems * static_cast<double>(ltw(wei).nelems())
+                    / static_cast<double>(oc);
+        }
+        default: return 0;
+    }
+}
+
+// The cost of a compiled partition is the compute of its matmuls and
+// convolutions plus the elements it reads and writes at its boundary.
+double partition_cost(const compiled_partition_t *cp) {
+    using ltw = logical_tensor_wrapper_t;
+    double cost = 0;
+    for (const auto &op : cp->src_partition().get_ops())
+        cost += compute_cost(*op);
+    for (const auto &in : cp->get_inputs())
+        if (!ltw(in).is_shape_unknown()) cost += ltw(in).nelems();
+    for (const auto &out : cp->get_outputs())
+        if (!ltw(out).is_shape_unknown()) cost += ltw(out).nelems();
+    return std::max(cost, 1.0);
+}
+
+// The number of threads the parallel regions started on a stream use.
+int stream_num_threads(const stream_t *stream) {
+    const auto *impl = stream->impl();
+    if (impl->num_threads() > 0) return impl->num_threads();
+    if (!impl->cpu_mask().empty())
+        return static_cast<int>(impl->cpu_mask().size());
+    return dnnl_get_max_threads();
+}
+
+double estimate_duration(double cost, int nthr) {
+    const double useful_nthr = std::min(static_cast<double>(nthr),
+            std::max(1.0, cost / min_work_per_thread));
+    return cost / useful_nthr;
+}
+
+} // namespace
+
+dnnl_graph_schedule::~dnnl_graph_schedule() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &w : workers_)
+        w.join();
+}
+
+status_t dnnl_graph_schedule::init(
+        const std::vector<const compiled_partition_t *> &compiled_partitions,
+        const std::vector<stream_t *> &streams) {
+    const size_t ncps = compiled_partitions.size();
+    const size_t nstreams = streams.size();
+    if (nstreams == 0) return status::invalid_arguments;
+
+    std::unordered_set<const stream_t *> unique_streams;
+    for (const auto *s : streams) {
+        if (s->flags() & dnnl::impl::stream_flags::out_of_order)
+            return status::invalid_arguments;
+        if (!unique_streams.insert(s).second) return status::invalid_arguments;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        // OpenMP teams of concurrent streams do not share threads, so each
+        // stream has to be limited to its part of the cores
+        if (nstreams > 1 && s->engine()->kind() == engine_kind::cpu
+                && s->impl()->num_threads() == 0
+                && s->impl()->cpu_mask().empty())
+            return status::invalid_arguments;
+#endif
+        for (const auto *cp : compiled_partitions) {
+            if (s->engine()->kind() != cp->get_engine()->kind())
+                return status::invalid_arguments;
+        }
+    }
+
+    // tensor id -> producing compiled partition
+    std::unordered_map<size_t, size_t> producer;
+    for (size_t i = 0; i < ncps; ++i) {
+        for (const auto &out : compiled_partitions[i]->get_outputs()) {
+            if (!producer.emplace(out.id, i).second)
+                return status::invalid_arguments;
+        }
+    }
+
+    // tensor id -> compiled partitions consuming it so far
+    std::unordered_map<size_t, std::vector<size_t>> consumers;
+    std::vector<std::vector<size_t>> deps(ncps), succs(ncps);
+    for (size_t i = 0; i < ncps; ++i) {
+        const auto *cp = compiled_partitions[i];
+        for (const auto &in : cp->get_inputs()) {
+            auto it = producer.find(in.id);
+            if (it != producer.end()) {
+                // Consumers which appear before the producer mean that the
+                // given order is not a valid execution order
+                if (it->second >= i) return status::invalid_arguments;
+                deps[i].push_back(it->second);
+            }
+        }
+        // An output which is computed in place overwrites its input, so it
+        // has to wait for the previous readers of the input as well
+        for (const auto &pair : cp->get_inplace_pairs()) {
+            auto it = consumers.find(pair.input_id);
+            if (it == consumers.end()) continue;
+            deps[i].insert(deps[i].end(), it->second.begin(), it->second.end());
+        }
+        for (const auto &in : cp->get_inputs())
+            consumers[in.id].push_back(i);
+
+        std::sort(deps[i].begin(), deps[i].end());
+        deps[i].erase(
+                std::unique(deps[i].begin(), deps[i].end()), deps[i].end());
+        for (const size_t d : deps[i])
+            succs[d].push_back(i);
+    }
+
+    std::vector<int> nthr(nstreams);
+    for (size_t s = 0; s < nstreams; ++s)
+        nthr[s] = stream_num_threads(streams[s]);
+
+    // duration[i][s]: estimated duration of compiled partition i on stream s
+    std::vector<std::vector<double>> duration(ncps);
+    std::vector<double> mean_duration(ncps);
+    for (size_t i = 0; i < ncps; ++i) {
+        const double cost = partition_cost(compiled_partitions[i]);
+        for (size_t s = 0; s < nstreams; ++s)
+            duration[i].push_back(estimate_duration(cost, nthr[s]));
+        mean_duration[i]
+                = std::accumulate(duration[i].begin(), duration[i].end(), 0.0)
+                / static_cast<double>(nstreams);
+    }
+
+    // The rank of a compiled partition is the estimated length of the longest
+    // path from it to the end of the graph. Successors follow their
+    // predecessors in the given order, so a reverse traversal computes it.
+    std::vector<double> rank(ncps, 0);
+    for (size_t i = ncps; i-- > 0;) {
+        double succ_rank = 0;
+        for (const size_t succ : succs[i])
+            succ_rank = std::max(succ_rank, rank[succ]);
+        rank[i] = mean_duration[i] + succ_rank;
+    }
+
+    // Durations are positive, so a compiled partition always ranks higher
+    // than its successors and the visiting order is a valid execution order.
+    std::vector<size_t> visit(ncps);
+    std::iota(visit.begin(), visit.end(), 0);
+    std::stable_sort(visit.begin(), visit.end(),
+            [&](size_t a, size_t b) { return rank[a] > rank[b]; });
+
+    std::vector<double> finish(ncps, 0), available(nstreams, 0);
+    std::vector<size_t> stream_of(ncps, 0);
+    std::vector<std::vector<size_t>> order(nstreams);
+    for (const size_t i : visit) {
+        double ready = 0;
+        for (const size_t d : deps[i])
+            ready = std::max(ready, finish[d]);
+
+        size_t best = 0;
+        double best_finish = 0;
+        for (size_t s = 0; s < nstreams; ++s) {
+            const double f = std::max(ready, available[s]) + duration[i][s];
+            if (s == 0 || f < best_finish) {
+                best = s;
+                best_finish = f;
+            }
+        }
+        finish[i] = best_finish;
+        available[best] = best_finish;
+        stream_of[i] = best;
+        order[best].push_back(i);
+    }
+
+    cps_ = compiled_partitions;
+    streams_ = streams;
+    deps_ = std::move(deps);
+    stream_of_ = std::move(stream_of);
+    order_ = std::move(order);
+    return status::success;
+}
+
+status_t dnnl_graph_schedule::query_stream_index(
+        size_t index, size_t *stream_index) const {
+    if (index >= stream_of_.size()) return status::invalid_arguments;
+    *stream_index = stream_of_[index];
+    return status::success;
+}
+
+status_t dnnl_graph_schedule::execute(
+        const std::vector<const tensor_t *> &tensors) {
+    std::unordered_map<size_t, const tensor_t *> tensor_of;
+    for (const auto *t : tensors)
+        tensor_of[t->get_logical_tensor().id] = t;
+
+    const size_t ncps = cps_.size();
+    inputs_.assign(ncps, {});
+    outputs_.assign(ncps, {});
+    for (size_t i = 0; i < ncps; ++i) {
+        for (const auto &in : cps_[i]->get_inputs()) {
+            auto it = tensor_of.find(in.id);
+            if (it == tensor_of.end()) return status::invalid_arguments;
+            inputs_[i].push_back(it->second);
+        }
+        for (const auto &out : cps_[i]->get_outputs()) {
+            auto it = tensor_of.find(out.id);
+            if (it == tensor_of.end()) return status::invalid_arguments;
+            outputs_[i].push_back(it->second);
+        }
+    }
+
+    // Host threads driving the other streams are kept between executions so
+    // that the thread teams and their bindings are created once.
+    for (size_t s = workers_.size() + 1; s < streams_.size(); ++s)
+        workers_.emplace_back(&dnnl_graph_schedule::worker, this, s);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_.assign(ncps, false);
+        status_ = status::success;
+        num_running_ = streams_.size() - 1;
+        generation_++;
+    }
+    cv_.notify_all();
+
+    run_stream(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return num_running_ == 0; });
+    return status_;
+}
+
+void dnnl_graph_schedule::run_stream(size_t stream_index) {
+    stream_t *stream = streams_[stream_index];
+    for (const size_t i : order_[stream_index]) {
+        bool failed = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] {
+                for (const size_t d : deps_[i])
+                    if (!done_[d]) return false;
+                return true;
+            });
+            failed = status_ != status::success;
+        }
+
+        // After a failure the remaining compiled partitions are skipped but
+        // still marked as done, so that no stream waits for them forever.
+        status_t st = status::success;
+        if (!failed) {
+            st = dnnl_graph_compiled_partition_execute(cps_[i], stream,
+                    inputs_[i].size(), inputs_[i].data(), outputs_[i].size(),
+                    outputs_[i].data());
+            // Consumers on other streams may only start after the results
+            // are ready
+            if (st == status::success) st = stream->wait();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (st != status::success && status_ == status::success)
+                status_ = st;
+            done_[i] = true;
+        }
+        cv_.notify_all();
+    }
+}
+
+void dnnl_graph_schedule::worker(size_t stream_index) {
+    size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] { return stop_ || generation_ != generation; });
+            if (stop_) return;
+            generation = generation_;
+        }
+
+        run_stream(stream_index);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_running_--;
+        }
+        cv_.notify_all();
+    }
+}
+
+status_t DNNL_API dnnl_graph_schedule_create(schedule_t **schedule,
+        size_t num_compiled_partitions,
+        const compiled_partition_t **compiled_partitions, size_t num_streams,
+        stream_t **streams) {
+    if (utils::any_null(schedule, compiled_partitions, streams))
+        return status::invalid_arguments;
+
+    std::vector<const compiled_partition_t *> cps {
+            compiled_partitions, compiled_partitions + num_compiled_partitions};
+    for (const auto *cp : cps) {
+        if (!cp || !cp->is_initialized()) return status::invalid_arguments;
+    }
+    std::vector<stream_t *> strms {streams, streams + num_streams};
+    for (const auto *s : strms) {
+        if (!s) return status::invalid_arguments;
+    }
+
+    *schedule = new schedule_t();
+    const status_t ret = (*schedule)->init(cps, strms);
+    if (ret != status::success) {
+        delete *schedule;
+        *schedule = nullptr;
+    }
+    return ret;
+}
+
+status_t DNNL_API dnnl_graph_schedule_query_stream_index(
+        const schedule_t *schedule, size_t index, size_t *stream_index) {
+    if (utils::any_null(schedule, stream_index))
+        return status::invalid_arguments;
+
+    return schedule->query_stream_index(index, stream_index);
+}
+
+status_t DNNL_API dnnl_graph_schedule_execute(
+        schedule_t *schedule, size_t num_tensors, const tensor_t **tensors) {
+    if (utils::any_null(schedule, tensors)) return status::invalid_arguments;
+
+    std::vector<const tensor_t *> ts {tensors, tensors + num_tensors};
+    for (const auto *t : ts) {
+        if (!t) return status::invalid_arguments;
+    }
+
+    return schedule->execute(ts);
+}
+
+status_t DNNL_API dnnl_graph_schedule_destroy(schedule_t *schedule) {
+    delete schedule;
+    return status::success;
+}
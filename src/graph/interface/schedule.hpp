@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_SCHEDULE_HPP
+#define GRAPH_INTERFACE_SCHEDULE_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+
+// The schedule executes independent compiled partitions concurrently. Each
+// stream given by users stands for a group of threads, e.g. a CPU stream with
+// a number of threads and a CPU mask set through stream attributes, and is
+// driven by its own host thread.
+//
+// The assignment of compiled partitions to streams is static and follows the
+// HEFT list scheduling heuristic: compiled partitions are visited by the
+// decreasing length of the most expensive path from them to the end of the
+// graph, and each of them goes to the stream on which it is estimated to
+// finish first. The cost of a compiled partition is estimated from its ops,
+// and its duration on a stream from the cost and the number of threads the
+// stream can use for it.
+struct dnnl_graph_schedule {
+public:
+    dnnl_graph_schedule() = default;
+
+    ~dnnl_graph_schedule();
+
+    dnnl::impl::graph::status_t init(
+            const std::vector<const dnnl::impl::graph::compiled_partition_t *>
+                    &compiled_partitions,
+            const std::vector<dnnl::impl::graph::stream_t *> &streams);
+
+    dnnl::impl::graph::status_t query_stream_index(
+            size_t index, size_t *stream_index) const;
+
+    dnnl::impl::graph::status_t execute(
+            const std::vector<const dnnl::impl::graph::tensor_t *> &tensors);
+
+private:
+    // Executes the compiled partitions assigned to a stream in order.
+    void run_stream(size_t stream_index);
+
+    // Body of the host thread which drives a stream other than the first one,
+    // the first stream is driven by the thread calling execute().
+    void worker(size_t stream_index);
+
+    std::vector<const dnnl::impl::graph::compiled_partition_t *> cps_;
+    std::vector<dnnl::impl::graph::stream_t *> streams_;
+
+    // compiled partition -> compiled partitions it has to wait for
+    std::vector<std::vector<size_t>> deps_;
+    // compiled partition -> stream
+    std::vector<size_t> stream_of_;
+    // stream -> compiled partitions in execution order
+    std::vector<std::vector<size_t>> order_;
+
+    // Arguments of the current execution
+    std::vector<std::vector<const dnnl::impl::graph::tensor_t *>> inputs_;
+    std::vector<std::vector<const dnnl::impl::graph::tensor_t *>> outputs_;
+
+    // Execution state, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<bool> done_;
+    size_t generation_ = 0;
+    size_t num_running_ = 0;
+    bool stop_ = false;
+    dnnl::impl::graph::status_t status_ = dnnl::impl::graph::status::success;
+
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -2556,6 +2556,49 @@ status_t infer_dnnl_sdpa_bwd_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_dnnl_split_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in = ltw(inputs[0]);
+    const auto ndims = in.ndims();
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    if (axis < -ndims || axis >= ndims) return status::invalid_arguments;
+    if (axis < 0) axis += ndims;
+
+    const auto &sizes = n->get_attr<std::vector<int64_t>>(op_attr::sizes);
+    VCHECK_INVALID_SHAPE(sizes.size() == outputs.size(),
+            "%s, number of sizes should be equal to number of outputs. "
+            "sizes: %zu, outputs: %zu",
+            op_t::kind2str(n->get_kind()).c_str(), sizes.size(),
+            outputs.size());
+
+    int64_t sum = 0;
+    for (const auto &s : sizes)
+        sum += s;
+    VCHECK_INVALID_SHAPE(sum == in.dims()[axis],
+            "%s, sum of sizes should be equal to input dim on axis. "
+            "sum: %d, input dim: %d",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(sum),
+            static_cast<int>(in.dims()[axis]));
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        dims inferred_out_shape = in.vdims();
+        inferred_out_shape[axis] = sizes[i];
+
+        auto out = ltw(outputs[i]);
+        if (!out.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(inferred_out_shape, out.vdims()),
+                    "%s, inferred out shape and output shape are not "
+                    "compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+            continue;
+        }
+        set_shape_and_strides(*outputs[i], inferred_out_shape);
+    }
+
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
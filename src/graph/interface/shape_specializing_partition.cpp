@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <utility>
+
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/shape_specializing_partition.hpp"
+#include "graph/interface/tensor.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+namespace {
+
+// Builds the concrete logical tensor for a template port from the metadata of
+// the tensor given on execution. Dimensions known at compilation must match.
+status_t specialize_logical_tensor(logical_tensor_t &concrete,
+        const logical_tensor_t &templ, const logical_tensor_t &given) {
+    using ltw = logical_tensor_wrapper_t;
+    if (given.id != templ.id || given.data_type != templ.data_type
+            || given.ndims != templ.ndims || !ltw(given).is_strided()
+            || ltw(given).is_shape_unknown() || ltw(given).is_stride_unknown())
+        return status::invalid_arguments;
+
+    for (int d = 0; d < templ.ndims; ++d) {
+        if (templ.dims[d] != DNNL_GRAPH_UNKNOWN_DIM
+                && templ.dims[d] != given.dims[d])
+            return status::invalid_arguments;
+    }
+
+    concrete = given;
+    concrete.property = templ.property;
+    return status::success;
+}
+
+void append_to_key(std::vector<dim_t> &key, const logical_tensor_t &lt) {
+    key.push_back(lt.ndims);
+    key.insert(key.end(), lt.dims, lt.dims + lt.ndims);
+    key.insert(key.end(), lt.layout.strides, lt.layout.strides + lt.ndims);
+}
+
+} // namespace
+
+bool shape_specializing_compiled_partition_impl_t::is_applicable(
+        const partition_t &src_partition,
+        const std::vector<const logical_tensor_t *> &inputs,
+        const std::vector<const logical_tensor_t *> &outputs) {
+    using ltw = logical_tensor_wrapper_t;
+    if (inputs.size() != src_partition.get_inputs_num()
+            || outputs.size() != src_partition.get_outputs_num())
+        return false;
+
+    bool has_unknown_dims = false;
+    for (const auto *in : inputs) {
+        // Only the dimensions may be left unknown. The rank is needed to
+        // validate the tensors given on execution.
+        if (ltw(in).ndims() < 0 || !ltw(in).is_strided()) return false;
+        has_unknown_dims = has_unknown_dims || ltw(in).is_shape_unknown();
+    }
+    if (!has_unknown_dims) return false;
+
+    for (const auto *out : outputs) {
+        if (ltw(out).ndims() < 0
+                || !(ltw(out).is_strided() || ltw(out).is_any()))
+            return false;
+    }
+    return true;
+}
+
+status_t shape_specializing_compiled_partition_impl_t::get_specialization(
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs,
+        std::shared_ptr<compiled_partition_t> &specialization) {
+    if (inputs.size() != inputs_.size() || outputs.size() != outputs_.size())
+        return status::invalid_arguments;
+
+    std::vector<logical_tensor_t> ins(inputs.size()), outs(outputs.size());
+    key_t key;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        CHECK(specialize_logical_tensor(
+                ins[i], inputs_[i], inputs[i].get_logical_tensor()));
+        append_to_key(key, ins[i]);
+    }
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        CHECK(specialize_logical_tensor(
+                outs[i], outputs_[i], outputs[i].get_logical_tensor()));
+        append_to_key(key, outs[i]);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            specializations_.splice(
+                    specializations_.begin(), specializations_, it->second);
+            specialization = it->second->second;
+            return status::success;
+        }
+    }
+
+    // Compile outside of the lock. Concurrent compilations of the same
+    // shapes are deduplicated by the global compiled partition cache.
+    std::vector<const logical_tensor_t *> in_ptrs, out_ptrs;
+    for (const auto &in : ins)
+        in_ptrs.push_back(&in);
+    for (const auto &out : outs)
+        out_ptrs.push_back(&out);
+
+    auto cp = std::make_shared<compiled_partition_t>(src_partition_);
+    std::pair<compiled_partition_t *, cache_state_t> cp_state {
+            cp.get(), cache_state_t::compiled_partition_hit};
+    CHECK(src_partition_.compile(cp_state, in_ptrs, out_ptrs, engine_));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Another thread may have compiled the same shapes meanwhile.
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        specializations_.splice(
+                specializations_.begin(), specializations_, it->second);
+        specialization = it->second->second;
+        return status::success;
+    }
+    if (specializations_.size() >= max_specializations_) {
+        index_.erase(specializations_.back().first);
+        specializations_.pop_back();
+    }
+    specializations_.emplace_front(key, cp);
+    index_.emplace(std::move(key), specializations_.begin());
+    specialization = std::move(cp);
+    return status::success;
+}
+
+status_t shape_specializing_compiled_partition_impl_t::execute(
+        const stream_t *astream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    std::shared_ptr<compiled_partition_t> specialization;
+    CHECK(get_specialization(inputs, outputs, specialization));
+    return specialization->execute(astream, inputs, outputs);
+}
+
+#ifdef DNNL_WITH_SYCL
+status_t shape_specializing_compiled_partition_impl_t::execute_sycl(
+        const stream_t *astream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs,
+        const std::vector<::sycl::event> &sycl_deps,
+        ::sycl::event *sycl_event) {
+    std::shared_ptr<compiled_partition_t> specialization;
+    CHECK(get_specialization(inputs, outputs, specialization));
+    return specialization->execute_sycl(
+            astream, inputs, outputs, sycl_deps, sycl_event);
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+status_t shape_specializing_compiled_partition_impl_t::execute_ocl(
+        const stream_t *astream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs,
+        const std::vector<cl_event> &ocl_deps, cl_event *ocl_event) {
+    std::shared_ptr<compiled_partition_t> specialization;
+    CHECK(get_specialization(inputs, outputs, specialization));
+    return specialization->execute_ocl(
+            astream, inputs, outputs, ocl_deps, ocl_event);
+}
+#endif
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_SHAPE_SPECIALIZING_PARTITION_HPP
+#define GRAPH_INTERFACE_SHAPE_SPECIALIZING_PARTITION_HPP
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+/// A compiled partition whose input logical tensors were given with unknown
+/// dimensions at compilation. Such a compiled partition only records the
+/// template logical tensors and defers the compilation to execution, where
+/// the concrete shapes are taken from the given tensors. This is not
+/// shape-polymorphic compilation: each new shape goes through the whole
+/// compilation, including the backend passes, since the passes bake the
+/// concrete dimensions into the lowered subgraph. The results are memoized
+/// per object, so executing with a shape seen before only costs a map lookup.
+class shape_specializing_compiled_partition_impl_t
+    : public compiled_partition_impl_t {
+public:
+    shape_specializing_compiled_partition_impl_t(const engine_t &engine,
+            const partition_t &src_partition,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs)
+        : compiled_partition_impl_t(engine, inputs, outputs, {})
+        , src_partition_(src_partition) {}
+
+    /// Checks whether compiling @p src_partition with the given inputs
+    /// should produce a shape-specializing compiled partition: all inputs have
+    /// known ranks, at least one of them has unknown dimensions and all
+    /// inputs with unknown dimensions use the strided layout.
+    static bool is_applicable(const partition_t &src_partition,
+            const std::vector<const logical_tensor_t *> &inputs,
+            const std::vector<const logical_tensor_t *> &outputs);
+
+    std::string str() const override { return "shape_specializing"; }
+
+    status_t execute(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t execute_sycl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override;
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t execute_ocl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &ocl_deps,
+            cl_event *ocl_event) override;
+#endif
+
+private:
+    // Returns the compiled partition specialized for the shapes and strides
+    // of the given tensors, compiling it on the first use.
+    status_t get_specialization(const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            std::shared_ptr<compiled_partition_t> &specialization);
+
+    // Upper bound on the number of memoized specializations. The least
+    // recently used one is dropped first. The compiled partitions themselves
+    // are owned by the global cache as well, so dropping an entry here only
+    // costs a global cache lookup.
+    static constexpr size_t max_specializations_ = 128;
+
+    const partition_t src_partition_;
+
+    using key_t = std::vector<dim_t>;
+    using specialization_t
+            = std::pair<key_t, std::shared_ptr<compiled_partition_t>>;
+
+    std::mutex mutex_;
+    // Specializations from the most to the least recently used.
+    std::list<specialization_t> specializations_;
+    std::map<key_t, std::list<specialization_t>::iterator> index_;
+};
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
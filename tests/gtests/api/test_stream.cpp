@@ -21,6 +21,14 @@
 
 #include <tuple>
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include <omp.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#include "src/common/stream.hpp"
+#endif
+
 namespace dnnl {
 
 static bool are_valid_flags(
@@ -34,6 +42,8 @@ static bool are_valid_flags(
     if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
 #endif
+    if (engine_kind != dnnl_cpu && (stream_flags & dnnl_stream_numa_aware))
+        ok = false;
     return ok;
 }
 
@@ -135,6 +145,81 @@ TEST(stream_test_c_t, GetStream) {
     DNNL_CHECK(dnnl_stream_destroy(stream));
     DNNL_CHECK(dnnl_engine_destroy(engine));
 }
+
+TEST(stream_test_cpp_t, StreamAttr) {
+    stream_attr attr;
+    ASSERT_EQ(attr.get_num_threads(), 0);
+    ASSERT_TRUE(attr.get_cpu_mask().empty());
+    EXPECT_ANY_THROW(attr.set_num_threads(-1));
+    EXPECT_ANY_THROW(attr.set_cpu_mask({0, -1}));
+
+    attr.set_num_threads(2);
+    attr.set_cpu_mask({0});
+    ASSERT_EQ(attr.get_num_threads(), 2);
+    ASSERT_EQ(attr.get_cpu_mask(), std::vector<int>({0}));
+
+    engine eng(engine::kind::cpu, 0);
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP
+    EXPECT_ANY_THROW(stream(eng, stream::flags::in_order, attr));
+#else
+    const int max_threads = omp_get_max_threads();
+#ifdef __linux__
+    cpu_set_t affinity;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(affinity), &affinity), 0);
+#endif
+
+    stream s(eng, stream::flags::in_order, attr);
+
+    // The stream runs executions between these hooks: parallel regions use
+    // the requested number of threads, all bound to the CPUs of the mask.
+    s.get()->before_exec_hook();
+    std::vector<int> cpus(2, -1);
+    int nthr = 0;
+#pragma omp parallel
+    {
+        const int ithr = omp_get_thread_num();
+        if (ithr == 0) nthr = omp_get_num_threads();
+#ifdef __linux__
+        if (ithr < (int)cpus.size()) cpus[ithr] = sched_getcpu();
+#endif
+    }
+    s.get()->after_exec_hook();
+    ASSERT_EQ(nthr, 2);
+#ifdef __linux__
+    ASSERT_EQ(cpus, std::vector<int>({0, 0}));
+#endif
+    ASSERT_EQ(omp_get_max_threads(), max_threads);
+
+    // Both threads of the parallel regions run on CPU 0.
+    const memory::dim n = 1024;
+    auto md = memory::desc({n}, memory::data_type::f32, memory::format_tag::a);
+    memory src(md, eng), dst(md, eng);
+    float *src_ptr = static_cast<float *>(src.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        src_ptr[i] = (i % 2) ? 1.f : -1.f;
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward(relu_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const float *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(dst_ptr[i], (i % 2) ? 1.f : 0.f);
+
+    // The settings of the calling thread are restored after the execution.
+    ASSERT_EQ(omp_get_max_threads(), max_threads);
+#ifdef __linux__
+    cpu_set_t affinity_after;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(affinity_after), &affinity_after), 0);
+    ASSERT_TRUE(CPU_EQUAL(&affinity, &affinity_after));
+#endif
+#endif
+
+    // Default attributes are accepted by any engine.
+    stream_attr empty_attr;
+    stream s_default(eng, stream::flags::in_order, empty_attr);
+}
 #endif
 
 namespace {
@@ -148,7 +233,9 @@ struct print_to_string_param_name_t {
 };
 
 auto all_params = ::testing::Combine(::testing::Values(dnnl_cpu, dnnl_gpu),
-        ::testing::Values(dnnl_stream_in_order, dnnl_stream_out_of_order));
+        ::testing::Values(dnnl_stream_in_order, dnnl_stream_out_of_order,
+                static_cast<dnnl_stream_flags_t>(
+                        dnnl_stream_in_order | dnnl_stream_numa_aware)));
 
 } // namespace
 
@@ -884,7 +884,9 @@ inline std::string to_string(dnnl_engine_kind_t engine_kind) {
 
 inline std::string to_string(dnnl_stream_flags_t stream_flags) {
     dnnl::impl::stringstream_t ss;
-    if (stream_flags & dnnl_stream_default_flags)
+    if (stream_flags & dnnl_stream_numa_aware)
+        ss << "numa_aware";
+    else if (stream_flags & dnnl_stream_default_flags)
         ss << "default";
     else if (stream_flags & dnnl_stream_in_order)
         ss << "in_order";
@@ -19,6 +19,7 @@
 #include "test_api_common.hpp"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
 
 TEST(APIPartition, PartitionTest) {
@@ -456,3 +457,303 @@ TEST(APIPartition, UseMultipleEngines) {
     // Executing cp1 with eng2 should throw exception.
     EXPECT_ANY_THROW(cp1.execute(str2, {ts_src2, ts_wei2}, {ts_output2}));
 }
+
+// Compiling with unknown input dimensions produces a compiled partition which
+// is specialized for the shapes of the tensors given on execution.
+TEST(APIPartition, CompileWithUnknownInputDims) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    const int64_t M = DNNL_GRAPH_UNKNOWN_DIM, K = 64, N = 32;
+
+    graph g(engine::kind::cpu);
+    auto src = logical_tensor(0, dt, {M, K}, strided);
+    auto wei = logical_tensor(1, dt, {K, N}, strided);
+    auto dst = logical_tensor(2, dt, {M, N}, strided);
+    auto output = logical_tensor(3, dt, {M, N}, strided);
+
+    auto matmul = op(4, op::kind::MatMul, "matmul");
+    matmul.add_inputs({src, wei});
+    matmul.add_outputs({dst});
+    auto relu = op(5, op::kind::ReLU, "relu");
+    relu.add_inputs({dst});
+    relu.add_outputs({output});
+
+    g.add_op(matmul);
+    g.add_op(relu);
+    g.finalize();
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 1UL);
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    auto cp = parts[0].compile({src, wei}, {output}, eng);
+    ASSERT_EQ(cp.query_logical_tensor(0).get_dims()[0], DNNL_GRAPH_UNKNOWN_DIM);
+    ASSERT_EQ(cp.query_logical_tensor(3).get_dims()[0], DNNL_GRAPH_UNKNOWN_DIM);
+
+    std::vector<float> wei_data(K * N, 1.f);
+    auto ts_wei = tensor(wei, eng, wei_data.data());
+
+    // Execute with several batch sizes, including a repeated one.
+    for (int64_t mb : {16, 8, 16, 3}) {
+        std::vector<float> src_data(mb * K, 0.5f);
+        std::vector<float> out_data(mb * N, 0.f);
+        auto ts_src = tensor(
+                logical_tensor(0, dt, {mb, K}, strided), eng, src_data.data());
+        auto ts_out = tensor(
+                logical_tensor(3, dt, {mb, N}, strided), eng, out_data.data());
+        ASSERT_NO_THROW(cp.execute(strm, {ts_src, ts_wei}, {ts_out}));
+        strm.wait();
+        for (const auto &v : out_data)
+            ASSERT_FLOAT_EQ(v, 0.5f * K);
+    }
+
+    // Dimensions known at compilation must match on execution.
+    std::vector<float> src_data(8 * (K + 1), 0.f);
+    std::vector<float> out_data(8 * N, 0.f);
+    auto ts_bad_src = tensor(
+            logical_tensor(0, dt, {8, K + 1}, strided), eng, src_data.data());
+    auto ts_out = tensor(
+            logical_tensor(3, dt, {8, N}, strided), eng, out_data.data());
+    EXPECT_ANY_THROW(cp.execute(strm, {ts_bad_src, ts_wei}, {ts_out}));
+}
+
+// The tensors connecting a chain of compiled partitions are planned into one
+// buffer. Only two of them are alive at any time, so the buffer must be smaller
+// than the sum of the tensor sizes.
+TEST(APIMemoryPlan, PlanPartitionChain) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    const std::vector<int64_t> dims {16, 64};
+    const size_t nelems = 16 * 64;
+    const size_t num_ops = 4;
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    std::vector<logical_tensor> lts;
+    for (size_t i = 0; i <= num_ops; ++i)
+        lts.emplace_back(i, dt, dims, strided);
+
+    std::vector<compiled_partition> cps;
+    for (size_t i = 0; i < num_ops; ++i) {
+        op relu(num_ops + 1 + i, op::kind::ReLU, "relu");
+        relu.add_input(lts[i]);
+        relu.add_output(lts[i + 1]);
+        partition p(relu, engine::kind::cpu);
+        cps.push_back(p.compile({lts[i]}, {lts[i + 1]}, eng));
+    }
+
+    memory_plan plan(cps);
+    const size_t size = plan.get_size();
+    ASSERT_GE(size, nelems * sizeof(float));
+    ASSERT_LE(size, 2 * nelems * sizeof(float));
+
+    // The graph input is provided by users and is not planned.
+    EXPECT_ANY_THROW(plan.query_offset(0));
+    for (size_t i = 1; i <= num_ops; ++i)
+        ASSERT_LT(plan.query_offset(i), size);
+
+    std::vector<float> src_data(nelems);
+    for (size_t i = 0; i < nelems; ++i)
+        src_data[i] = (i % 2) ? -1.f : static_cast<float>(i);
+    std::vector<char> arena(size);
+
+    tensor ts_src(lts[0], eng, src_data.data());
+    for (size_t i = 0; i < num_ops; ++i) {
+        tensor ts_in = i == 0 ? ts_src
+                              : tensor(lts[i], eng,
+                                      arena.data() + plan.query_offset(i));
+        tensor ts_out(
+                lts[i + 1], eng, arena.data() + plan.query_offset(i + 1));
+        cps[i].execute(strm, {ts_in}, {ts_out});
+    }
+    strm.wait();
+
+    const float *dst = reinterpret_cast<const float *>(
+            arena.data() + plan.query_offset(num_ops));
+    for (size_t i = 0; i < nelems; ++i)
+        ASSERT_FLOAT_EQ(dst[i], std::max(src_data[i], 0.f));
+
+    // A tensor must be produced before it is consumed.
+    std::vector<compiled_partition> reversed(cps.rbegin(), cps.rend());
+    EXPECT_ANY_THROW(memory_plan {reversed});
+}
+
+// Outputs which are not consumed are only kept until the end of the sequence
+// if they are live-out.
+TEST(APIMemoryPlan, PlanLiveOutTensors) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    const std::vector<int64_t> dims {16, 64};
+    const size_t tensor_size = 16 * 64 * sizeof(float);
+    const size_t num_ops = 4;
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+
+    // Each partition reads the graph input 0 and writes a tensor which is
+    // not consumed by the other partitions
+    logical_tensor src(0, dt, dims, strided);
+    std::vector<compiled_partition> cps;
+    for (size_t i = 0; i < num_ops; ++i) {
+        logical_tensor dst(i + 1, dt, dims, strided);
+        op relu(num_ops + 1 + i, op::kind::ReLU, "relu");
+        relu.add_input(src);
+        relu.add_output(dst);
+        partition p(relu, engine::kind::cpu);
+        cps.push_back(p.compile({src}, {dst}, eng));
+    }
+
+    // By default all of them are live-out
+    memory_plan all_live(cps);
+    ASSERT_GE(all_live.get_size(), num_ops * tensor_size);
+
+    // Only the listed ones keep their memory
+    memory_plan two_live(cps, {1, 3});
+    const size_t size = two_live.get_size();
+    ASSERT_GE(size, 2 * tensor_size);
+    ASSERT_LT(size, num_ops * tensor_size);
+    ASSERT_NE(two_live.query_offset(1), two_live.query_offset(3));
+    // Tensor 2 is dead once it is produced, so tensor 3 can take its memory
+    ASSERT_NE(two_live.query_offset(4), two_live.query_offset(1));
+    ASSERT_NE(two_live.query_offset(4), two_live.query_offset(3));
+
+    memory_plan none_live(cps, {});
+    ASSERT_LT(none_live.get_size(), 2 * tensor_size);
+
+    // Live-out tensors must be produced by the compiled partitions
+    EXPECT_ANY_THROW(memory_plan(cps, {0}));
+}
+
+// Only primitive executions are recorded, so compiled partitions are rejected
+// by a recording stream.
+TEST(APIPartition, ExecuteOnRecordingStream) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    logical_tensor src_lt(0, dt, {4, 16}, strided);
+    logical_tensor dst_lt(1, dt, {4, 16}, strided);
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    op relu(2, op::kind::ReLU, {src_lt}, {dst_lt}, "relu");
+    partition p(relu, engine::kind::cpu);
+    auto cp = p.compile({src_lt}, {dst_lt}, eng);
+
+    std::vector<float> src(4 * 16, -1.f), dst(4 * 16, 1.f);
+    tensor ts_src(src_lt, eng, src.data());
+    tensor ts_dst(dst_lt, eng, dst.data());
+
+    dnnl::begin_recording(strm);
+    EXPECT_ANY_THROW(cp.execute(strm, {ts_src}, {ts_dst}));
+    auto cl = dnnl::end_recording(strm);
+    ASSERT_EQ(cl.get_length(), 0);
+    for (float v : dst)
+        ASSERT_EQ(v, 1.f);
+
+    cp.execute(strm, {ts_src}, {ts_dst});
+    strm.wait();
+    for (float v : dst)
+        ASSERT_EQ(v, 0.f);
+}
+
+// The two branches of a diamond are independent, so they are assigned to
+// different streams and executed concurrently.
+TEST(APISchedule, ScheduleDiamond) {
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    const std::vector<int64_t> dims {16, 64};
+    const size_t nelems = 16 * 64;
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    std::vector<dnnl::stream> strms;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Each stream runs its compiled partitions on a single thread
+    dnnl::stream_attr attr;
+    attr.set_num_threads(1);
+    for (int s = 0; s < 2; ++s)
+        strms.emplace_back(eng, dnnl::stream::flags::in_order, attr);
+#else
+    strms.emplace_back(eng);
+    strms.emplace_back(eng);
+#endif
+
+    std::vector<logical_tensor> lts;
+    for (size_t i = 0; i < 5; ++i)
+        lts.emplace_back(i, dt, dims, strided);
+
+    op relu(5, op::kind::ReLU, {lts[0]}, {lts[1]}, "relu");
+    op branch_a(6, op::kind::ReLU, {lts[1]}, {lts[2]}, "branch_a");
+    op branch_b(7, op::kind::Square, {lts[1]}, {lts[3]}, "branch_b");
+    op add(8, op::kind::Add, {lts[2], lts[3]}, {lts[4]}, "add");
+
+    std::vector<compiled_partition> cps;
+    cps.push_back(partition(relu, engine::kind::cpu)
+                          .compile({lts[0]}, {lts[1]}, eng));
+    cps.push_back(partition(branch_a, engine::kind::cpu)
+                          .compile({lts[1]}, {lts[2]}, eng));
+    cps.push_back(partition(branch_b, engine::kind::cpu)
+                          .compile({lts[1]}, {lts[3]}, eng));
+    cps.push_back(partition(add, engine::kind::cpu)
+                          .compile({lts[2], lts[3]}, {lts[4]}, eng));
+
+    schedule sched(cps, strms);
+    ASSERT_NE(sched.query_stream_index(1), sched.query_stream_index(2));
+    EXPECT_ANY_THROW(sched.query_stream_index(4));
+
+    std::vector<std::vector<float>> data(5, std::vector<float>(nelems));
+    for (size_t i = 0; i < nelems; ++i)
+        data[0][i] = (i % 2) ? -1.f : static_cast<float>(i % 7);
+    std::vector<tensor> ts;
+    for (size_t i = 0; i < 5; ++i)
+        ts.emplace_back(lts[i], eng, data[i].data());
+
+    // The schedule is executed twice to reuse the host threads.
+    for (int iter = 0; iter < 2; ++iter) {
+        std::fill(data[4].begin(), data[4].end(), 0.f);
+        sched.execute(ts);
+        for (size_t i = 0; i < nelems; ++i) {
+            const float r = std::max(data[0][i], 0.f);
+            ASSERT_FLOAT_EQ(data[4][i], r + r * r);
+        }
+    }
+
+    // Every input and output of the compiled partitions must be provided.
+    EXPECT_ANY_THROW(sched.execute({ts[0], ts[1], ts[2], ts[3]}));
+
+    // A tensor must be produced before it is consumed.
+    std::vector<compiled_partition> reversed(cps.rbegin(), cps.rend());
+    EXPECT_ANY_THROW((schedule {reversed, strms}));
+    // Streams must be distinct.
+    EXPECT_ANY_THROW((schedule {cps, {strms[0], strms[0]}}));
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Concurrent streams must not use all the threads each.
+    EXPECT_ANY_THROW((schedule {cps, {dnnl::stream(eng), strms[1]}}));
+    ASSERT_NO_THROW((schedule {cps, {dnnl::stream(eng)}}));
+#endif
+}
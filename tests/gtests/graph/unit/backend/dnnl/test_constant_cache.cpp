@@ -15,6 +15,15 @@
 *******************************************************************************/
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #include "interface/constant_tensor_cache.hpp"
 
 #include "backend/dnnl/dnnl_constant_tensor_cache.hpp"
@@ -110,3 +119,161 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+#ifndef _WIN32
+TEST(test_constant_cache, MappedBufferSharedThroughFiles) {
+    SKIP_IF(get_test_engine_kind() != graph::engine_kind::cpu,
+            "mapped constant buffers are supported on CPU only");
+    graph::engine_t &engine = *get_engine();
+
+    char dir[] = "/tmp/onednn_graph_constant_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    ASSERT_EQ(::setenv("ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR", dir, 1), 0);
+
+    dnnl::impl::sha256_t sha;
+    sha.update(std::string("1234"));
+    const auto key = sha.finalize();
+    dnnl::impl::sha256_t content_sha;
+    content_sha.update(std::string("weights"));
+    const auto content = content_sha.finalize();
+    const size_t size = 4096;
+    auto create = [&](const graph::mapped_constant_buffer_t::key_t &digest) {
+        return graph::mapped_constant_buffer_t::create(
+                key, digest, size, &engine);
+    };
+    auto producer = create(content);
+    ASSERT_NE(producer, nullptr);
+    ASSERT_FALSE(producer->is_filled());
+    std::memset(producer->data<char>(), 7, size);
+
+    // The content is not visible to others before it is committed
+    auto early = create(content);
+    ASSERT_NE(early, nullptr);
+    ASSERT_FALSE(early->is_filled());
+    early.reset();
+
+    producer->commit();
+    auto consumer = create(content);
+    ASSERT_NE(consumer, nullptr);
+    ASSERT_TRUE(consumer->is_filled());
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(consumer->data<char>()[i], 7);
+
+    // The content survives the buffer which computed it
+    producer.reset();
+    consumer.reset();
+    auto restarted = create(content);
+    ASSERT_NE(restarted, nullptr);
+    ASSERT_TRUE(restarted->is_filled());
+    restarted.reset();
+
+    // A file computed from other constant inputs of the same key is not
+    // mapped, but replaced on commit
+    dnnl::impl::sha256_t other_sha;
+    other_sha.update(std::string("other weights"));
+    const auto other_content = other_sha.finalize();
+    auto updated = create(other_content);
+    ASSERT_NE(updated, nullptr);
+    ASSERT_FALSE(updated->is_filled());
+    std::memset(updated->data<char>(), 9, size);
+    updated->commit();
+    updated.reset();
+
+    auto outdated = create(content);
+    ASSERT_NE(outdated, nullptr);
+    ASSERT_FALSE(outdated->is_filled());
+    outdated.reset();
+    auto reloaded = create(other_content);
+    ASSERT_NE(reloaded, nullptr);
+    ASSERT_TRUE(reloaded->is_filled());
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(reloaded->data<char>()[i], 9);
+    reloaded.reset();
+
+    ASSERT_EQ(::unsetenv("ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR"), 0);
+    ASSERT_EQ(create(content), nullptr);
+
+    // Only the committed file is left in the directory
+    size_t num_files = 0;
+    DIR *d = opendir(dir);
+    ASSERT_NE(d, nullptr);
+    while (struct dirent *e = readdir(d)) {
+        if (e->d_name[0] == '.') continue;
+        num_files++;
+        ::unlink((std::string(dir) + "/" + e->d_name).c_str());
+    }
+    closedir(d);
+    ::rmdir(dir);
+    ASSERT_EQ(num_files, 1U);
+}
+
+TEST(test_constant_cache, MappedBufferUntrustedFiles) {
+    SKIP_IF(get_test_engine_kind() != graph::engine_kind::cpu,
+            "mapped constant buffers are supported on CPU only");
+    graph::engine_t &engine = *get_engine();
+
+    char dir[] = "/tmp/onednn_graph_constant_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    ASSERT_EQ(::setenv("ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR", dir, 1), 0);
+
+    dnnl::impl::sha256_t sha;
+    sha.update(std::string("5678"));
+    const auto key = sha.finalize();
+    dnnl::impl::sha256_t content_sha;
+    content_sha.update(std::string("weights"));
+    const auto content = content_sha.finalize();
+    const size_t size = 4096;
+    auto create = [&](const graph::mapped_constant_buffer_t::key_t &digest) {
+        return graph::mapped_constant_buffer_t::create(
+                key, digest, size, &engine);
+    };
+    auto producer = create(content);
+    ASSERT_NE(producer, nullptr);
+    std::memset(producer->data<char>(), 7, size);
+    producer->commit();
+    producer.reset();
+
+    std::string path;
+    DIR *d = opendir(dir);
+    ASSERT_NE(d, nullptr);
+    while (struct dirent *e = readdir(d)) {
+        if (e->d_name[0] == '.') continue;
+        path = std::string(dir) + "/" + e->d_name;
+    }
+    closedir(d);
+    ASSERT_FALSE(path.empty());
+
+    auto is_trusted = [&]() {
+        auto buffer = create(content);
+        return buffer && buffer->is_filled();
+    };
+    ASSERT_TRUE(is_trusted());
+
+    // Files writable by others are not mapped
+    ASSERT_EQ(::chmod(path.c_str(), 0622), 0);
+    ASSERT_FALSE(is_trusted());
+    ASSERT_EQ(::chmod(path.c_str(), 0600), 0);
+    ASSERT_TRUE(is_trusted());
+
+    // Neither are files with another digest in the header
+    FILE *f = fopen(path.c_str(), "r+b");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fseek(f, 16, SEEK_SET), 0);
+    const int c = fgetc(f);
+    ASSERT_EQ(fseek(f, 16, SEEK_SET), 0);
+    ASSERT_NE(fputc(c ^ 1, f), EOF);
+    fclose(f);
+    ASSERT_FALSE(is_trusted());
+
+    // Nor symbolic links
+    const std::string target = path + ".target";
+    ASSERT_EQ(::rename(path.c_str(), target.c_str()), 0);
+    ASSERT_EQ(::symlink(target.c_str(), path.c_str()), 0);
+    ASSERT_EQ(create(content), nullptr);
+
+    ASSERT_EQ(::unsetenv("ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR"), 0);
+    ::unlink(path.c_str());
+    ::unlink(target.c_str());
+    ::rmdir(dir);
+}
+#endif
@@ -1370,3 +1370,124 @@ TEST(test_large_partition_execute, Int8Bf16GptMha_CPU) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(test_large_partition_execute, F32GatedMlpWithConstantWeights) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    const auto ekind = static_cast<dnnl_engine_kind_t>(eng->kind());
+
+    // The gate and up matmuls share src and have constant weights, so they
+    // are merged into one matmul when the constant tensor cache is enabled.
+    const graph::dim_t mb = 4, ic = 32, hs = 16;
+    size_t id = 0;
+    auto src = utils::logical_tensor_init(
+            id++, {1, mb, ic}, graph::data_type::f32);
+    auto wei_gate
+            = utils::logical_tensor_init(id++, {ic, hs}, graph::data_type::f32);
+    auto wei_up
+            = utils::logical_tensor_init(id++, {ic, hs}, graph::data_type::f32);
+    auto wei_down
+            = utils::logical_tensor_init(id++, {hs, ic}, graph::data_type::f32);
+    for (auto *lt : {&wei_gate, &wei_up, &wei_down})
+        lt->property = graph::property_type::constant;
+    auto gate_dst = utils::logical_tensor_init(
+            id++, {1, mb, hs}, graph::data_type::f32);
+    auto act_dst = utils::logical_tensor_init(
+            id++, {1, mb, hs}, graph::data_type::f32);
+    auto up_dst = utils::logical_tensor_init(
+            id++, {1, mb, hs}, graph::data_type::f32);
+    auto mul_dst = utils::logical_tensor_init(
+            id++, {1, mb, hs}, graph::data_type::f32);
+    auto dst = utils::logical_tensor_init(
+            id++, {1, mb, ic}, graph::data_type::f32);
+
+    graph::op_t fc_gate {0, graph::op_kind::MatMul, "fc_gate"};
+    fc_gate.add_input(src);
+    fc_gate.add_input(wei_gate);
+    fc_gate.add_output(gate_dst);
+    graph::op_t act {1, graph::op_kind::ReLU, "act"};
+    act.add_input(gate_dst);
+    act.add_output(act_dst);
+    graph::op_t fc_up {2, graph::op_kind::MatMul, "fc_up"};
+    fc_up.add_input(src);
+    fc_up.add_input(wei_up);
+    fc_up.add_output(up_dst);
+    graph::op_t mul {3, graph::op_kind::Multiply, "mul"};
+    mul.add_input(act_dst);
+    mul.add_input(up_dst);
+    mul.add_output(mul_dst);
+    graph::op_t fc_down {4, graph::op_kind::MatMul, "fc_down"};
+    fc_down.add_input(mul_dst);
+    fc_down.add_input(wei_down);
+    fc_down.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&fc_gate, &act, &fc_up, &mul, &fc_down})
+        g.add_op(op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("gated_mlp");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    size_t capacity = 0;
+    dnnl_graph_get_constant_tensor_cache_capacity(ekind, &capacity);
+    dnnl_graph_set_constant_tensor_cache_capacity(ekind, 1024);
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    // src is an input of both the gate and up matmuls
+    ASSERT_EQ(partition_inputs.size(), 5U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_outputs_ts;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        size_t first = 0;
+        while (inputs[first]->id != inputs[i]->id)
+            ++first;
+        if (first < i) {
+            // the same tensor is given for each use of src
+            const test_tensor_t shared = inputs_ts[first];
+            inputs_ts.push_back(shared);
+            continue;
+        }
+        inputs_ts.emplace_back(*inputs[i], eng);
+        inputs_ts.back().fill<float>();
+    }
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        ref_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    // the second execution reads the concatenated weights from the cache
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+        ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+                /*rtol*/ 1e-5f, /*atol*/ 1e-5f));
+    }
+
+    dnnl_graph_set_constant_tensor_cache_capacity(ekind, capacity);
+}
@@ -2493,3 +2493,185 @@ TEST(test_subgraph_pass, FuseNXCConvolutionBinaryAddNC11PostSrc) {
     ASSERT_EQ(post_ops.size(), 1U);
 #endif
 }
+
+TEST(test_subgraph_pass, FuseHorizontalMatmuls) {
+    /*
+                  src
+              /    |    \
+        matmul  matmul  matmul
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    const auto ekind = static_cast<dnnl_engine_kind_t>(g_eng->kind());
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    size_t capacity = 0;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_capacity(ekind, &capacity),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(ekind, 1024),
+            dnnl_success);
+
+    size_t id = 0;
+    auto src = logical_tensor_init(id++, {2, 4, 16}, graph::data_type::f32);
+    graph::graph_t g;
+    std::vector<op_ptr> matmuls;
+    const std::vector<int64_t> ns {8, 8, 4};
+    for (size_t i = 0; i < ns.size(); ++i) {
+        auto wei = logical_tensor_init(
+                id++, {16, ns[i]}, graph::data_type::f32);
+        wei.property = graph::property_type::constant;
+        auto dst = logical_tensor_init(
+                id++, {2, 4, ns[i]}, graph::data_type::f32);
+        matmuls.emplace_back(std::make_shared<graph::op_t>(
+                i, graph::op_kind::MatMul, "matmul"));
+        matmuls.back()->add_input(src);
+        matmuls.back()->add_input(wei);
+        matmuls.back()->add_output(dst);
+        g.add_op(matmuls.back().get());
+    }
+    g.finalize();
+
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            graph::graph_t::deep_copy(g.get_ops()), p_eng, fpm, false,
+            /* reset_layout */ false);
+    ASSERT_EQ(graph::dnnl_impl::lower_down(subgraph), graph::status::success);
+    ASSERT_EQ(graph::dnnl_impl::fuse_horizontal_matmuls(subgraph),
+            graph::status::success);
+    ASSERT_EQ(graph::dnnl_impl::infer_shape(subgraph), graph::status::success);
+
+    ASSERT_EQ(subgraph->get_ops().size(), 3U);
+    size_t num_matmul = 0;
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() == graph::op_kind::_matmul) {
+            num_matmul++;
+            const auto wei = op->get_input_logical_tensor(1);
+            ASSERT_EQ(ltw(wei).vdims(), (std::vector<int64_t> {16, 20}));
+            ASSERT_TRUE(ltw(wei).is_constant());
+            const auto dst = op->get_output_logical_tensor(0);
+            ASSERT_EQ(ltw(dst).vdims(), (std::vector<int64_t> {2, 4, 20}));
+        } else if (op->get_kind() == graph::op_kind::_split) {
+            ASSERT_EQ(op->num_outputs(), ns.size());
+            for (size_t i = 0; i < ns.size(); ++i) {
+                const auto dst = op->get_output_logical_tensor(i);
+                ASSERT_EQ(dst.id, 2 * i + 2);
+                ASSERT_EQ(ltw(dst).vdims(),
+                        (std::vector<int64_t> {2, 4, ns[i]}));
+            }
+        } else {
+            ASSERT_EQ(op->get_kind(), graph::op_kind::_concat);
+        }
+    }
+    ASSERT_EQ(num_matmul, 1U);
+
+    // Without the constant tensor cache, the weights are not concatenated.
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(ekind, 0),
+            dnnl_success);
+    auto subgraph1 = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            graph::graph_t::deep_copy(g.get_ops()), p_eng, fpm, false,
+            /* reset_layout */ false);
+    ASSERT_EQ(graph::dnnl_impl::lower_down(subgraph1), graph::status::success);
+    ASSERT_EQ(graph::dnnl_impl::fuse_horizontal_matmuls(subgraph1),
+            graph::status::success);
+    ASSERT_EQ(subgraph1->get_ops().size(), 3U);
+
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(ekind, capacity),
+            dnnl_success);
+}
+
+TEST(test_subgraph_pass, FuseHorizontalMatmulsWithBiasAndPostOps) {
+    /*
+                      src
+              /        |        \
+        matmul(b)  matmul(b)  matmul(b)
+            |
+           relu
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    const auto ekind = static_cast<dnnl_engine_kind_t>(g_eng->kind());
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    size_t capacity = 0;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_capacity(ekind, &capacity),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(ekind, 1024),
+            dnnl_success);
+
+    size_t id = 0;
+    auto src = logical_tensor_init(id++, {2, 4, 16}, graph::data_type::f32);
+    graph::graph_t g;
+    std::vector<op_ptr> ops;
+    const std::vector<int64_t> ns {8, 8, 4};
+    for (size_t i = 0; i < ns.size(); ++i) {
+        auto wei = logical_tensor_init(
+                id++, {16, ns[i]}, graph::data_type::f32);
+        wei.property = graph::property_type::constant;
+        auto bias = logical_tensor_init(id++, {ns[i]}, graph::data_type::f32);
+        bias.property = graph::property_type::constant;
+        auto dst = logical_tensor_init(
+                id++, {2, 4, ns[i]}, graph::data_type::f32);
+        ops.emplace_back(std::make_shared<graph::op_t>(
+                ops.size(), graph::op_kind::MatMul, "matmul"));
+        ops.back()->add_input(src);
+        ops.back()->add_input(wei);
+        ops.back()->add_input(bias);
+        ops.back()->add_output(dst);
+        g.add_op(ops.back().get());
+        if (i != 0) continue;
+
+        auto relu_dst = logical_tensor_init(
+                id++, {2, 4, ns[i]}, graph::data_type::f32);
+        ops.emplace_back(std::make_shared<graph::op_t>(
+                ops.size(), graph::op_kind::ReLU, "relu"));
+        ops.back()->add_input(dst);
+        ops.back()->add_output(relu_dst);
+        g.add_op(ops.back().get());
+    }
+    g.finalize();
+
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+    ASSERT_EQ(graph::dnnl_impl::lower_down(subgraph), graph::status::success);
+    ASSERT_EQ(graph::dnnl_impl::fuse_horizontal_matmuls(subgraph),
+            graph::status::success);
+    ASSERT_EQ(
+            graph::dnnl_impl::fuse_post_ops(subgraph), graph::status::success);
+    ASSERT_EQ(graph::dnnl_impl::infer_shape(subgraph), graph::status::success);
+
+    // The matmul followed by relu keeps it as a post-op, the other two are
+    // fused with their biases concatenated
+    ASSERT_EQ(subgraph->get_ops().size(), 5U);
+    size_t num_matmul = 0, num_concat = 0;
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() == graph::op_kind::_matmul) {
+            num_matmul++;
+            ASSERT_EQ(op->num_inputs(), 3U);
+            const auto wei = op->get_input_logical_tensor(1);
+            const auto bias = op->get_input_logical_tensor(2);
+            if (op->has_attr(graph::op_attr::fusion_info)) {
+                const auto &fusion_info
+                        = op->get_attr<dnnl_impl::fusion_info_t>(
+                                graph::op_attr::fusion_info);
+                ASSERT_EQ(fusion_info.get_post_ops().size(), 1U);
+                ASSERT_EQ(ltw(wei).vdims(), (std::vector<int64_t> {16, 8}));
+                ASSERT_EQ(ltw(bias).vdims(), (std::vector<int64_t> {8}));
+            } else {
+                ASSERT_EQ(ltw(wei).vdims(), (std::vector<int64_t> {16, 12}));
+                ASSERT_EQ(ltw(bias).vdims(), (std::vector<int64_t> {12}));
+                ASSERT_TRUE(ltw(bias).is_constant());
+            }
+        } else if (op->get_kind() == graph::op_kind::_concat) {
+            num_concat++;
+        } else {
+            ASSERT_EQ(op->get_kind(), graph::op_kind::_split);
+            ASSERT_EQ(op->num_outputs(), 2U);
+        }
+    }
+    ASSERT_EQ(num_matmul, 2U);
+    ASSERT_EQ(num_concat, 2U);
+
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(ekind, capacity),
+            dnnl_success);
+}
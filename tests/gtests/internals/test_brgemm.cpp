@@ -26,6 +26,16 @@
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/jit_code_registry.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#endif
 
 namespace dnnl {
 
@@ -289,4 +299,94 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+TEST(brgemm_shared_code_test_t, TestIdenticalKernelsShareCode) {
+    using namespace dnnl::impl::cpu::x64;
+    SKIP_IF(!jit_code_registry::is_enabled(), "Code sharing is disabled.");
+
+    brgemm_desc_t desc;
+    const auto st = brgemm_desc_init(&desc, isa_undef, brgemm_addr, dnnl_f32,
+            dnnl_f32, false, false, brgemm_row_major, 1.f, 0.f, 64, 64, 64,
+            16, 64, 64);
+    SKIP_IF(st == dnnl_unimplemented, "Unsupported ISA.");
+    ASSERT_EQ(st, dnnl_success);
+    ASSERT_EQ(brgemm_desc_finalize(&desc), dnnl_success);
+
+    brgemm_kernel_t *kernels[2] = {};
+    for (auto &k : kernels)
+        ASSERT_EQ(brgemm_kernel_create(&k, desc), dnnl_success);
+
+    const auto *code = kernels[0]->get_jit_generator()->jit_ker();
+    ASSERT_EQ(code, kernels[1]->get_jit_generator()->jit_ker());
+    const size_t n_shared = jit_code_registry::get_size();
+
+    ASSERT_EQ(brgemm_kernel_destroy(kernels[0]), dnnl_success);
+    ASSERT_EQ(jit_code_registry::get_size(), n_shared);
+    ASSERT_EQ(brgemm_kernel_destroy(kernels[1]), dnnl_success);
+    ASSERT_EQ(jit_code_registry::get_size(), n_shared - 1);
+}
+
+#ifdef __linux__
+// Returns the permissions of the mapping which contains `p`.
+std::string get_mapping_perms(const void *p) {
+    std::ifstream maps("/proc/self/maps");
+    const unsigned long addr = reinterpret_cast<unsigned long>(p);
+    std::string line;
+    while (std::getline(maps, line)) {
+        unsigned long start = 0, end = 0;
+        char perms[5] = {};
+        if (std::sscanf(line.c_str(), "%lx-%lx %4s", &start, &end, perms) != 3)
+            continue;
+        if (addr >= start && addr < end) return perms;
+    }
+    return "";
+}
+
+TEST(brgemm_shared_code_test_t, TestCodeArena) {
+    using namespace dnnl::impl::cpu::x64;
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t block_size = 64;
+
+    jit_code_registry::code_arena_t arena(page_size);
+    Xbyak::uint8 *blocks[3] = {}, *writable[3] = {};
+    blocks[0] = arena.alloc(block_size, &writable[0]);
+    SKIP_IF(blocks[0] == nullptr, "Code pages cannot be mapped.");
+    for (int i = 1; i < 3; i++) {
+        blocks[i] = arena.alloc(block_size, &writable[i]);
+        ASSERT_EQ(blocks[i], blocks[0] + i * block_size);
+        ASSERT_EQ(writable[i], writable[0] + i * block_size);
+    }
+    ASSERT_EQ(arena.get_capacity(), page_size);
+    ASSERT_EQ(arena.get_num_free_blocks(), 1u);
+
+    // No page is writable and executable at the same time.
+    ASSERT_EQ(get_mapping_perms(blocks[1]), "r-xs");
+    ASSERT_EQ(get_mapping_perms(writable[1]), "rw-s");
+
+    // Code written through the alias runs from the block: mov eax, 42; ret
+    const Xbyak::uint8 code[] = {0xb8, 0x2a, 0x00, 0x00, 0x00, 0xc3};
+    std::memcpy(writable[1], code, sizeof(code));
+    ASSERT_EQ(reinterpret_cast<int (*)()>(blocks[1])(), 42);
+
+    // Released blocks are merged with their free neighbors.
+    arena.free(blocks[0], block_size);
+    ASSERT_EQ(arena.get_num_free_blocks(), 2u);
+    arena.free(blocks[2], block_size);
+    ASSERT_EQ(arena.get_num_free_blocks(), 2u);
+
+    // The smallest free block that fits is reused.
+    Xbyak::uint8 *w = nullptr;
+    ASSERT_EQ(arena.alloc(block_size, &w), blocks[0]);
+    ASSERT_EQ(w, writable[0]);
+    ASSERT_EQ(arena.get_num_free_blocks(), 1u);
+    arena.free(blocks[0], block_size);
+
+    arena.free(blocks[1], block_size);
+    ASSERT_EQ(arena.get_num_free_blocks(), 1u);
+
+    ASSERT_EQ(arena.alloc(page_size, &w), blocks[0]);
+    ASSERT_EQ(w, writable[0]);
+    ASSERT_EQ(arena.get_capacity(), page_size);
+}
+#endif
+
 } // namespace dnnl
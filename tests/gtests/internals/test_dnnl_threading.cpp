@@ -14,11 +14,21 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
 
 #include "common/compiler_workarounds.hpp"
+#include "common/counting_barrier.hpp"
+#include "common/rw_mutex.hpp"
+#include "common/spin_wait.hpp"
+#include "cpu/platform.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/cpu_barrier.hpp"
+#endif
 
 #include "gtest/gtest.h"
 
@@ -165,4 +175,158 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic() {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], [= COMPAT_THIS_CAPTURE](ptrdiff_t d0) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    data[d0] = d0;
+                });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1],
+                        [= COMPAT_THIS_CAPTURE](ptrdiff_t d0, ptrdiff_t d1) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                    const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                    data[idx] = idx;
+                });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic_ext(0, p.dims[0], p.dims[1],
+                        p.dims[2],
+                        [= COMPAT_THIS_CAPTURE](int ithr, int nthr,
+                                ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
+                    ASSERT_TRUE(0 <= ithr && ithr < nthr);
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                    ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                    const ptrdiff_t idx
+                            = (d0 * p.dims[1] + d1) * p.dims[2] + d2;
+                    data[idx] = idx;
+                });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    emit_parallel_nd_dynamic();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}},
+                np_t {{1000}}, np_t {{0, 0}}, np_t {{1, 2}},
+                np_t {{10, 10}}, np_t {{0, 1, 0}}, np_t {{1, 2, 1}},
+                np_t {{4, 4, 10}}, np_t {{7, 13, 29}}));
+
+TEST(test_balance_weighted, Test) {
+    const int weights[] = {5, 5, 3, 3, 3};
+    const int nthr = 5;
+    for (impl::dim_t n : {0, 1, 7, 19, 1000}) {
+        impl::dim_t prev_end = 0;
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            impl::dim_t start {0}, end {0};
+            impl::balance_weighted(n, nthr, ithr, weights, start, end);
+            ASSERT_EQ(start, prev_end);
+            ASSERT_LE(start, end);
+            prev_end = end;
+        }
+        ASSERT_EQ(prev_end, n);
+    }
+
+    // Faster cores get proportionally more work.
+    impl::dim_t start0 {0}, end0 {0}, start2 {0}, end2 {0};
+    impl::balance_weighted((impl::dim_t)1900, nthr, 0, weights, start0, end0);
+    impl::balance_weighted((impl::dim_t)1900, nthr, 2, weights, start2, end2);
+    ASSERT_EQ(end0 - start0, 500);
+    ASSERT_EQ(end2 - start2, 300);
+}
+
+#if DNNL_X64 && defined(__linux__)
+TEST(test_simple_barrier, TestSpinThenPark) {
+    using namespace impl::cpu::x64;
+    // Threads outnumber the cores on most machines, and with a short spin
+    // count the waiters park on the futex.
+    const int nthr = 16;
+    const int nrounds = 200;
+    const int saved_spin_count = impl::spin_wait::get_spin_count();
+    for (int spin_count : {0, 16, -1}) {
+        impl::spin_wait::set_spin_count(spin_count);
+        simple_barrier::ctx_t ctx;
+        simple_barrier::ctx_init(&ctx);
+        std::atomic<int> arrived {0};
+        std::atomic<int> nerrors {0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < nthr; i++)
+            threads.emplace_back([&]() {
+                for (int r = 0; r < nrounds; r++) {
+                    arrived++;
+                    simple_barrier::barrier(&ctx, nthr);
+                    if (arrived.load() < (r + 1) * nthr) nerrors++;
+                    simple_barrier::barrier(&ctx, nthr);
+                }
+            });
+        for (auto &t : threads)
+            t.join();
+        ASSERT_EQ(nerrors.load(), 0);
+        ASSERT_EQ(arrived.load(), nrounds * nthr);
+    }
+    impl::spin_wait::set_spin_count(saved_spin_count);
+}
+#endif
+
+TEST(test_counting_barrier, Test) {
+    const int nthr = 4;
+    const int nrounds = 100;
+    for (int r = 0; r < nrounds; r++) {
+        impl::counting_barrier_t barrier(nthr);
+        std::atomic<int> done {0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < nthr; i++)
+            threads.emplace_back([&]() {
+                done++;
+                barrier.notify();
+            });
+        barrier.wait();
+        ASSERT_EQ(done.load(), nthr);
+        for (auto &t : threads)
+            t.join();
+    }
+}
+
+TEST(test_sharded_rw_mutex, Test) {
+    const int nthr = 8;
+    const int niters = 1000;
+    impl::utils::sharded_rw_mutex_t mutex;
+    // The writers keep both values equal, the readers must never see them
+    // differ.
+    int a = 0, b = 0;
+    std::atomic<bool> is_consistent {true};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthr; i++)
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < niters; j++) {
+                if ((i + j) % 4 == 0) {
+                    impl::utils::lock_write_t lock_w(mutex);
+                    a++;
+                    b++;
+                } else {
+                    impl::utils::lock_read_t lock_r(mutex);
+                    if (a != b) is_consistent = false;
+                }
+            }
+        });
+    for (auto &t : threads)
+        t.join();
+    ASSERT_TRUE(is_consistent.load());
+    ASSERT_EQ(a, nthr * niters / 4);
+    ASSERT_EQ(a, b);
+}
+
 } // namespace dnnl
@@ -254,12 +254,19 @@ gmlp_tensors_t get_descriptors(engine &eng, stream &strm, mlp_dims_t p) {
 
     auto FC_retn_md_t = memory::desc(FC_down_sz, dst_dt, tag::ab);
 
+    // Without quantization the reference matmuls take the weights in the
+    // data type of the primitive: CPU matmul has no bf16 or f16 source with
+    // f32 weights.
+    const bool is_quantized = p.qtype != quantize_type::no_quantization;
+    auto ref_wgu_dt = is_quantized ? mdt::f32 : wgu_wt;
+    auto ref_wd_dt = is_quantized ? mdt::f32 : wd_wt;
+
     // clang-format off
     auto x_md = memory::desc(O_proj_sz, src_dt, tag::ab);
 
-    auto w_gate_md = memory::desc(W_gate_sz, mdt::f32, tag::ba);
-    auto w_up_md   = memory::desc(W_up_sz,   mdt::f32, tag::ba);
-    auto w_down_md = memory::desc(W_down_sz, mdt::f32, tag::ba);
+    auto w_gate_md = memory::desc(W_gate_sz, ref_wgu_dt, tag::ba);
+    auto w_up_md   = memory::desc(W_up_sz,   ref_wgu_dt, tag::ba);
+    auto w_down_md = memory::desc(W_down_sz, ref_wd_dt,  tag::ba);
 
     auto w_gate_qnt_md = memory::desc(W_gate_sz, wgu_wt, tag::ba);
     auto w_up_qnt_md   = memory::desc(W_up_sz,   wgu_wt, tag::ba);
@@ -852,13 +859,15 @@ public:
     }
 
 protected:
+    void compare();
+
     mlp_dims_t p;
     engine eng;
     stream strm;
     gmlp_tensors_t t;
 };
 
-TEST_P(mlp_test_t, compare) {
+void mlp_test_t::compare() {
     auto tensors = t;
     auto params = p;
 
@@ -920,6 +929,26 @@ TEST_P(mlp_test_t, compare) {
     ASSERT_LE(n_mismatches, threshold) << "out of: " << total_size;
 }
 
+TEST_P(mlp_test_t, compare) {
+    compare();
+}
+
+class mlp_cpu_test_t : public mlp_test_t {
+public:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "GMLP CPU tests require a CPU engine.");
+        p = GetParam();
+        eng = engine(engine::kind::cpu, 0);
+        strm = stream(eng);
+        t = get_descriptors(eng, strm, p);
+    }
+};
+
+TEST_P(mlp_cpu_test_t, compare) {
+    compare();
+}
+
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(VEC, mlp_test_t, ::testing::Values(
 /*
@@ -1238,6 +1267,38 @@ INSTANTIATE_TEST_SUITE_P(VEC, mlp_test_t, ::testing::Values(
             mdt::f32, mdt::f16, mdt::u8,
             mdt::f32, mdt::f16, mdt::u8}
 ), &PrintToString);
+
+INSTANTIATE_TEST_SUITE_P(CPU, mlp_cpu_test_t, ::testing::Values(
+    mlp_dims_t{1, 64, 96, 1, 1,
+            quantize_type::no_quantization, dnnl_eltwise_swish,
+            mdt::f32, mdt::f32,
+            mdt::f32, mdt::f16, mdt::u8,
+            mdt::f32, mdt::f16, mdt::u8}
+    ,
+    mlp_dims_t{45, 128, 200, 1, 1,
+            quantize_type::no_quantization, dnnl_eltwise_gelu_erf,
+            mdt::f32, mdt::f32,
+            mdt::f32, mdt::f16, mdt::u8,
+            mdt::f32, mdt::f16, mdt::u8}
+    ,
+    mlp_dims_t{70, 96, 64, 1, 1,
+            quantize_type::no_quantization, dnnl_eltwise_gelu_tanh,
+            mdt::f32, mdt::f32,
+            mdt::f32, mdt::f16, mdt::u8,
+            mdt::f32, mdt::f16, mdt::u8}
+    ,
+    mlp_dims_t{70, 96, 64, 1, 1,
+            quantize_type::no_quantization, dnnl_eltwise_gelu_tanh,
+            mdt::bf16, mdt::bf16,
+            mdt::bf16, mdt::f16, mdt::u8,
+            mdt::bf16, mdt::f16, mdt::u8}
+    ,
+    mlp_dims_t{200, 128, 300, 1, 1,
+            quantize_type::no_quantization, dnnl_eltwise_swish,
+            mdt::bf16, mdt::f32,
+            mdt::bf16, mdt::f16, mdt::u8,
+            mdt::bf16, mdt::f16, mdt::u8}
+), &PrintToString);
 // clang-format on
 
 } // namespace impl
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/common/dnnl_thread.hpp"
+#include "src/cpu/platform.hpp"
+
+namespace dnnl {
+
+// The output of a convolution must not depend on the NUMA split, including
+// when the execution is nested in a parallel region and gets fewer threads
+// than there are nodes.
+TEST(numa_aware_stream_test, TestConvolution) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "NUMA-aware streams are supported on CPU only.");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(engine::kind::cpu, 0);
+    auto src_md = memory::desc({2, 32, 10, 10}, dt::f32, tag::nhwc);
+    auto wei_md = memory::desc({64, 32, 3, 3}, dt::f32, tag::any);
+    auto dst_md = memory::desc({2, 64, 8, 8}, dt::f32, tag::nhwc);
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {0, 0}, {0, 0});
+    convolution_forward conv(pd);
+
+    auto fill = [](const memory &m) {
+        float *p = static_cast<float *>(m.get_data_handle());
+        const size_t n = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; i++)
+            p[i] = static_cast<float>((i * 7) % 13) - 6.f;
+    };
+    memory src(pd.src_desc(), eng), wei(pd.weights_desc(), eng);
+    fill(src);
+    fill(wei);
+
+    auto run = [&](stream &strm, bool nested) {
+        memory dst(pd.dst_desc(), eng);
+        float *p = static_cast<float *>(dst.get_data_handle());
+        const size_t n = pd.dst_desc().get_size() / sizeof(float);
+        std::fill(p, p + n, std::numeric_limits<float>::quiet_NaN());
+        auto exec = [&] {
+            conv.execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst}});
+            strm.wait();
+        };
+        if (nested) {
+            impl::parallel(2, [&](int ithr, int) {
+                if (ithr == 0) exec();
+            });
+        } else {
+            exec();
+        }
+        return std::vector<float>(p, p + n);
+    };
+
+    stream plain(eng);
+    const auto ref = run(plain, false);
+
+    impl::cpu::platform::set_num_numa_nodes_to_use(2);
+    stream numa_aware(
+            eng, stream::flags::in_order | stream::flags::numa_aware);
+    const auto split = run(numa_aware, false);
+    const auto nested = run(numa_aware, true);
+    impl::cpu::platform::set_num_numa_nodes_to_use(0);
+
+    ASSERT_EQ(split.size(), ref.size());
+    ASSERT_EQ(nested.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_EQ(split[i], ref[i]) << "at " << i;
+        ASSERT_EQ(nested[i], ref[i]) << "at " << i;
+    }
+}
+
+// The same holds for a matmul, with weights both read in place and copied to
+// the per-thread buffers.
+TEST(numa_aware_stream_test, TestMatmul) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "NUMA-aware streams are supported on CPU only.");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(engine::kind::cpu, 0);
+    for (const auto wei_tag : {tag::ab, tag::ba}) {
+        auto src_md = memory::desc({64, 96}, dt::f32, tag::ab);
+        auto wei_md = memory::desc({96, 256}, dt::f32, wei_tag);
+        auto dst_md = memory::desc({64, 256}, dt::f32, tag::ab);
+        auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        matmul mm(pd);
+
+        auto fill = [](const memory &m) {
+            float *p = static_cast<float *>(m.get_data_handle());
+            const size_t n = m.get_desc().get_size() / sizeof(float);
+            for (size_t i = 0; i < n; i++)
+                p[i] = static_cast<float>((i * 7) % 13) - 6.f;
+        };
+        memory src(pd.src_desc(), eng), wei(pd.weights_desc(), eng);
+        fill(src);
+        fill(wei);
+
+        auto run = [&](stream &strm, bool nested) {
+            memory dst(pd.dst_desc(), eng);
+            float *p = static_cast<float *>(dst.get_data_handle());
+            const size_t n = pd.dst_desc().get_size() / sizeof(float);
+            std::fill(p, p + n, std::numeric_limits<float>::quiet_NaN());
+            auto exec = [&] {
+                mm.execute(strm,
+                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                                {DNNL_ARG_DST, dst}});
+                strm.wait();
+            };
+            if (nested) {
+                impl::parallel(2, [&](int ithr, int) {
+                    if (ithr == 0) exec();
+                });
+            } else {
+                exec();
+            }
+            return std::vector<float>(p, p + n);
+        };
+
+        stream plain(eng);
+        const auto ref = run(plain, false);
+
+        impl::cpu::platform::set_num_numa_nodes_to_use(2);
+        stream numa_aware(
+                eng, stream::flags::in_order | stream::flags::numa_aware);
+        const auto split = run(numa_aware, false);
+        const auto nested = run(numa_aware, true);
+        impl::cpu::platform::set_num_numa_nodes_to_use(0);
+
+        ASSERT_EQ(split.size(), ref.size());
+        ASSERT_EQ(nested.size(), ref.size());
+        for (size_t i = 0; i < ref.size(); i++) {
+            ASSERT_EQ(split[i], ref[i]) << "at " << i;
+            ASSERT_EQ(nested[i], ref[i]) << "at " << i;
+        }
+    }
+}
+
+} // namespace dnnl
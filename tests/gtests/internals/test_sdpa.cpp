@@ -3536,3 +3536,153 @@ INSTANTIATE_TEST_SUITE_P(bwd_large_batch, sdpa_bwd_test_datatypes,
         &print_to_string2);
 
 // clang-format on
+
+// Fused CPU implementation: compared against a naive reference.
+struct sdpa_cpu_params_t {
+    memory::dim mb, q_heads, kv_heads, queries, keys, head_size;
+    mask_type mask;
+    bool invert_scale;
+    memory::format_tag key_tag;
+};
+
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "This test requires CPU engine");
+        p = GetParam();
+    }
+
+    void compare() {
+        using namespace dnnl::impl;
+        using tag = memory::format_tag;
+        dnnl::engine eng(engine::kind::cpu, 0);
+        dnnl::stream strm(eng);
+
+        const memory::dims q_sz = {p.mb, p.q_heads, p.queries, p.head_size};
+        const memory::dims k_sz = {p.mb, p.kv_heads, p.head_size, p.keys};
+        const memory::dims v_sz = {p.mb, p.kv_heads, p.keys, p.head_size};
+        const memory::dims msk_sz = {1, 1, p.queries, p.keys};
+
+        auto q_md = memory::desc(q_sz, mdt::f32, tag::abcd);
+        auto k_md = memory::desc(k_sz, mdt::f32, p.key_tag);
+        auto v_md = memory::desc(v_sz, mdt::f32, tag::abcd);
+        auto msk_md = memory::desc(msk_sz, mdt::f32, tag::abcd);
+        auto scale_md = memory::desc({1, 1, 1, 1}, mdt::f32, tag::abcd);
+        auto dst_md = memory::desc(q_sz, mdt::f32, tag::abcd);
+
+        std::vector<float> q_data(product(q_sz)), k_data(product(k_sz)),
+                v_data(product(v_sz)), msk_data(product(msk_sz));
+        fill_random(q_data, q_md);
+        fill_random(k_data, k_md);
+        fill_random(v_data, v_md);
+        fill_random(msk_data, msk_md);
+        const float scale_val = std::sqrt((float)p.head_size);
+
+        memory q_mem(q_md, eng), k_mem(k_md, eng), v_mem(v_md, eng),
+                msk_mem(msk_md, eng), scale_mem(scale_md, eng),
+                dst_mem(dst_md, eng);
+        write_to_dnnl_memory(q_data.data(), q_mem, eng, strm);
+        write_to_dnnl_memory(k_data.data(), k_mem, eng, strm);
+        write_to_dnnl_memory(v_data.data(), v_mem, eng, strm);
+        write_to_dnnl_memory(msk_data.data(), msk_mem, eng, strm);
+        write_to_dnnl_memory(&scale_val, scale_mem, eng, strm);
+
+        const bool with_buffer_mask = p.mask == mask_type::twoD;
+        sdpa::primitive_desc sdpa_pd;
+        try {
+            sdpa_pd = sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    with_buffer_mask ? &msk_md : nullptr, scale_md, dst_md,
+                    p.invert_scale, p.kv_heads, to_attn_mask_type(p.mask),
+                    dnnl::impl::alg_kind::softmax_accurate_inf_as_zero);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q_mem},
+                {DNNL_ARG_KEYS, k_mem}, {DNNL_ARG_VALUES, v_mem},
+                {DNNL_ARG_SCALE, scale_mem}, {DNNL_ARG_DST, dst_mem}};
+        if (with_buffer_mask) args[DNNL_ARG_ATTN_MASK] = msk_mem;
+        sdpa(sdpa_pd).execute(strm, args);
+        strm.wait();
+
+        const float *dst_data
+                = static_cast<const float *>(dst_mem.get_data_handle());
+
+        // Reads logical element (d, k) of a key tensor in abcd or abdc.
+        const auto k_off = [&](memory::dim mb, memory::dim h, memory::dim d,
+                                   memory::dim k) {
+            const memory::dim base = (mb * p.kv_heads + h) * p.head_size
+                    * p.keys;
+            return p.key_tag == tag::abcd ? base + d * p.keys + k
+                                          : base + k * p.head_size + d;
+        };
+
+        const float scale = p.invert_scale ? 1.f / scale_val : scale_val;
+        const memory::dim head_group = p.q_heads / p.kv_heads;
+        std::vector<double> s(p.keys);
+        for_(memory::dim mb = 0; mb < p.mb; mb++)
+        for_(memory::dim h = 0; h < p.q_heads; h++)
+        for (memory::dim q = 0; q < p.queries; q++) {
+            const memory::dim kvh = h / head_group;
+            double s_max = -INFINITY;
+            for (memory::dim k = 0; k < p.keys; k++) {
+                double acc = 0;
+                for (memory::dim d = 0; d < p.head_size; d++)
+                    acc += (double)q_data[((mb * p.q_heads + h) * p.queries + q)
+                                           * p.head_size
+                                   + d]
+                            * k_data[k_off(mb, kvh, d, k)];
+                acc *= scale;
+                if (with_buffer_mask) acc += msk_data[q * p.keys + k];
+                const bool masked = (p.mask == mask_type::causal_tl && k > q)
+                        || (p.mask == mask_type::causal_br
+                                && k > q + p.keys - p.queries);
+                s[k] = masked ? -INFINITY : acc;
+                s_max = std::max(s_max, s[k]);
+            }
+            double s_sum = 0;
+            for (memory::dim k = 0; k < p.keys; k++) {
+                s[k] = s_max == -INFINITY ? 0 : std::exp(s[k] - s_max);
+                s_sum += s[k];
+            }
+            for (memory::dim d = 0; d < p.head_size; d++) {
+                double acc = 0;
+                for (memory::dim k = 0; k < p.keys; k++)
+                    acc += s[k]
+                            * v_data[((mb * p.kv_heads + kvh) * p.keys + k)
+                                            * p.head_size
+                                    + d];
+                const double ref = s_sum > 0 ? acc / s_sum : 0;
+                const float got = dst_data[((mb * p.q_heads + h) * p.queries
+                                                   + q)
+                                * p.head_size
+                        + d];
+                ASSERT_NEAR(ref, got, 1e-3 * std::max(1.0, std::fabs(ref)))
+                        << "mb: " << mb << " h: " << h << " q: " << q
+                        << " d: " << d;
+            }
+        }
+    }
+
+    sdpa_cpu_params_t p;
+};
+
+TEST_P(sdpa_cpu_test_t, compare) {
+    compare();
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(brgemm_sdpa, sdpa_cpu_test_t,
+        testing::Values(
+                // mb, q_heads, kv_heads, queries, keys, head_size, mask, invert_scale, key_tag
+                sdpa_cpu_params_t {1, 1, 1, 1, 1, 16, mask_type::no_mask, true, memory::format_tag::abcd},
+                sdpa_cpu_params_t {1, 2, 2, 32, 32, 32, mask_type::no_mask, true, memory::format_tag::abcd},
+                sdpa_cpu_params_t {2, 2, 2, 45, 300, 64, mask_type::twoD, true, memory::format_tag::abcd},
+                sdpa_cpu_params_t {1, 4, 2, 70, 70, 64, mask_type::causal_tl, true, memory::format_tag::abdc},
+                sdpa_cpu_params_t {1, 4, 1, 17, 259, 32, mask_type::causal_br, false, memory::format_tag::abcd},
+                sdpa_cpu_params_t {2, 8, 2, 1, 385, 128, mask_type::no_mask, true, memory::format_tag::abdc},
+                sdpa_cpu_params_t {1, 2, 2, 40, 24, 16, mask_type::causal_br, true, memory::format_tag::abcd}));
+// clang-format on
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/sha256.hpp"
+
+namespace dnnl {
+
+TEST(sha256_test_t, TestFips180Vectors) {
+    using impl::sha256_t;
+    auto digest = [](const std::string &s, size_t chunk) {
+        sha256_t sha;
+        for (size_t i = 0; i < s.size(); i += chunk)
+            sha.update(s.data() + i, std::min(chunk, s.size() - i));
+        return sha256_t::to_hex(sha.finalize());
+    };
+    // Test vectors from FIPS 180-4 examples
+    ASSERT_EQ(digest("", 1),
+            "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    ASSERT_EQ(digest("abc", 1),
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    const std::string two_blocks
+            = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    for (size_t chunk : {1, 7, 64, 100})
+        ASSERT_EQ(digest(two_blocks, chunk),
+                "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db0"
+                "6c1");
+    ASSERT_EQ(digest(std::string(1000000, 'a'), 997),
+            "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+} // namespace dnnl
@@ -487,6 +487,60 @@ HANDLE_EXCEPTIONS_FOR_TEST(iface_grouped_test_t, TestMaxGroupMHint) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(iface_grouped_test_t, TestGroupedMatmulExecution) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() == engine::kind::gpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Test requires host-allocated memory.");
+
+    // Uneven groups, including an empty one and one large enough to be split
+    // between threads, with tails in both M and N.
+    const std::vector<int32_t> offsets = {37, 37, 40, 340, 341};
+    const int ngroups = (int)offsets.size();
+    const int M = offsets.back(), K = 48, N = 70;
+
+    auto src_md = memory::desc::grouped({M, K}, dt::f32, 0, ngroups);
+    auto wei_md
+            = memory::desc({ngroups, K, N}, dt::f32, memory::format_tag::abc);
+    auto dst_md = memory::desc::grouped({M, N}, dt::f32, 0, ngroups);
+
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md);
+    matmul prim(pd);
+    stream strm(eng);
+
+    // Small integers keep the results exact.
+    std::vector<float> src_data(M * K), wei_data(ngroups * K * N);
+    for (size_t i = 0; i < src_data.size(); i++)
+        src_data[i] = float((int)(i % 5) - 2);
+    for (size_t i = 0; i < wei_data.size(); i++)
+        wei_data[i] = float((int)(i % 7) - 3);
+    std::vector<float> dst_data(M * N, 0.f);
+
+    memory src_mem(src_md, eng,
+            {src_data.data(), const_cast<int32_t *>(offsets.data())});
+    memory wei_mem(wei_md, eng, wei_data.data());
+    memory dst_mem(dst_md, eng,
+            {dst_data.data(), const_cast<int32_t *>(offsets.data())});
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    for (int g = 0; g < ngroups; g++) {
+        const int m_start = g == 0 ? 0 : offsets[g - 1];
+        for (int m = m_start; m < offsets[g]; m++)
+            for (int n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (int k = 0; k < K; k++)
+                    ref += src_data[m * K + k]
+                            * wei_data[(g * K + k) * N + n];
+                ASSERT_EQ(dst_data[m * N + n], ref)
+                        << "g=" << g << " m=" << m << " n=" << n;
+            }
+    }
+}
+
 } // namespace dnnl
 
 #endif // DNNL_EXPERIMENTAL_GROUPED_MEMORY
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class prepared_primitive_test_t : public ::testing::Test {};
+
+TEST_F(prepared_primitive_test_t, TestMatmul) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 1, K = 64, N = 32;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    auto prim = matmul(pd);
+
+    std::vector<float> wei(K * N);
+    for (memory::dim i = 0; i < K * N; i++)
+        wei[i] = (float)(i % 7) - 3.f;
+    memory wei_mem(wei_md, eng, wei.data());
+    memory src_mem(src_md, eng, nullptr);
+    memory dst_mem(dst_md, eng, nullptr);
+
+    prepared_primitive prepared(prim, strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+
+    // Every execution uses new source and destination buffers and must
+    // match the regular execution.
+    const int niters = 3;
+    std::vector<std::vector<float>> src(niters, std::vector<float>(K));
+    std::vector<std::vector<float>> dst(niters, std::vector<float>(N));
+    for (int it = 0; it < niters; it++) {
+        for (memory::dim k = 0; k < K; k++)
+            src[it][k] = (float)((k + it) % 5) - 2.f;
+
+        prepared.execute({src[it].data(), wei.data(), dst[it].data()});
+        strm.wait();
+
+        std::vector<float> dst_ref(N);
+        memory src_ref_mem(src_md, eng, src[it].data());
+        memory dst_ref_mem(dst_md, eng, dst_ref.data());
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src_ref_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_ref_mem}});
+        strm.wait();
+
+        for (memory::dim n = 0; n < N; n++)
+            ASSERT_EQ(dst[it][n], dst_ref[n]);
+    }
+
+    // The handles of the last execution stay bound.
+    ASSERT_EQ(dst_mem.get_data_handle(), dst[niters - 1].data());
+    const auto last_dst = dst[niters - 1];
+    std::fill(dst[niters - 1].begin(), dst[niters - 1].end(), 0.f);
+    prepared.execute();
+    strm.wait();
+    ASSERT_EQ(dst[niters - 1], last_dst);
+}
+
+TEST_F(prepared_primitive_test_t, TestInvalidArguments) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc md({2, 8}, dt::f32, tag::ab);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    auto prim = eltwise_forward(pd);
+    memory src_mem(md, eng), dst_mem(md, eng);
+
+    prepared_primitive prepared(
+            prim, strm, {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem}});
+    // The number of handles must match the number of arguments.
+    std::vector<void *> handles {src_mem.get_data_handle()};
+    EXPECT_ANY_THROW(prepared.execute(handles));
+
+    // Out-of-order streams are not supported.
+    stream ooo_strm(eng, stream::flags::out_of_order);
+    EXPECT_ANY_THROW(prepared_primitive(prim, ooo_strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem}}));
+}
+
+TEST_F(prepared_primitive_test_t, TestKeepsArgumentsAlive) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc md({2, 8}, dt::f32, tag::ab);
+    const size_t nelems = md.get_size() / sizeof(float);
+    std::vector<float> src(nelems), dst(nelems, 0.f);
+    for (size_t i = 0; i < nelems; i++)
+        src[i] = (float)i - 8.f;
+
+    // The primitive and the memory objects are released by the caller right
+    // after the preparation.
+    prepared_primitive prepared;
+    {
+        auto pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f);
+        memory src_mem(md, eng, src.data()), dst_mem(md, eng, dst.data());
+        prepared = prepared_primitive(eltwise_forward(pd), strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem}});
+    }
+
+    prepared.execute();
+    strm.wait();
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst[i], std::max(src[i], 0.f));
+}
+
+TEST_F(prepared_primitive_test_t, TestCommandList) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    // dst = 2 * relu(src) + 1
+    memory::desc md({4, 16}, dt::f32, tag::ab);
+    auto relu = eltwise_forward(
+            eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+                    algorithm::eltwise_relu, md, md, 0.f));
+    auto linear = eltwise_forward(
+            eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+                    algorithm::eltwise_linear, md, md, 2.f, 1.f));
+
+    const size_t nelems = md.get_size() / sizeof(float);
+    std::vector<float> src(nelems), tmp(nelems, 0.f), dst(nelems, 0.f);
+    memory src_mem(md, eng, src.data());
+    memory tmp_mem(md, eng, tmp.data());
+    memory dst_mem(md, eng, dst.data());
+
+    begin_recording(strm);
+    relu.execute(strm, {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, tmp_mem}});
+    linear.execute(strm, {{DNNL_ARG_SRC, tmp_mem}, {DNNL_ARG_DST, dst_mem}});
+    auto cl = end_recording(strm);
+    ASSERT_EQ(cl.get_length(), 2);
+    // Nothing is executed while recording.
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst[i], 0.f);
+
+    for (int it = 0; it < 2; it++) {
+        for (size_t i = 0; i < nelems; i++)
+            src[i] = (float)((int)i % 9 - 4 + it);
+        cl.execute();
+        strm.wait();
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(dst[i], 2.f * std::max(src[i], 0.f) + 1.f);
+    }
+
+    // The stream is not recording anymore.
+    EXPECT_ANY_THROW(end_recording(strm));
+
+    // Submissions other than primitive executions are rejected while the
+    // stream is recording.
+    prepared_primitive prepared(
+            relu, strm, {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, tmp_mem}});
+    begin_recording(strm);
+    EXPECT_ANY_THROW(cl.execute());
+    EXPECT_ANY_THROW(prepared.execute());
+    ASSERT_EQ(end_recording(strm).get_length(), 0);
+}
+
+} // namespace dnnl
@@ -14,10 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/dnnl_thread.hpp"
 #include "src/common/primitive_cache.hpp"
 
 namespace {
@@ -127,6 +132,223 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestCostAwareEviction) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    ASSERT_EQ(dnnl_test_set_primitive_cache_eviction_policy(1, 0),
+            dnnl_success);
+
+    fill_primitive_cache(8);
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+
+    // Every entry takes at least a page, so none of them fits the limit.
+    ASSERT_EQ(dnnl_test_set_primitive_cache_eviction_policy(1, 1),
+            dnnl_success);
+    ASSERT_EQ(get_primitive_cache_size(), 0);
+    fill_primitive_cache(2);
+    ASSERT_EQ(get_primitive_cache_size(), 0);
+
+    ASSERT_EQ(dnnl_test_set_primitive_cache_eviction_policy(0, 0),
+            dnnl_success);
+    fill_primitive_cache(2);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+}
+
+// An entry which is expensive to create survives the eviction pressure of
+// cheap entries with the cost-aware policy, but not with LRU.
+TEST(primitive_cache_test, TestCostAwareEvictionKeepsCostlyEntry) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({64, 16, 8, 8}, dt::f32, tag::nchw);
+
+    for (int cost_aware : {1, 0}) {
+        set_primitive_cache_capacity(0);
+        set_primitive_cache_capacity(4);
+        ASSERT_EQ(dnnl_test_set_primitive_cache_eviction_policy(cost_aware, 0),
+                dnnl_success);
+
+        auto costly = eltwise_forward(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_tanh, md, md,
+                0.f, 0.f));
+        // One second is far above the creation time of the cheap entries.
+        ASSERT_EQ(dnnl_test_set_primitive_creation_time(costly.get(), 1e6),
+                dnnl_success);
+
+        fill_primitive_cache(16);
+        ASSERT_EQ(get_primitive_cache_size(), 4);
+        ASSERT_EQ(dnnl_test_is_primitive_in_cache(costly.get()), cost_aware);
+    }
+}
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    reset_primitive_cache_stats();
+
+    fill_primitive_cache(3);
+    fill_primitive_cache(3);
+    // Evict two entries.
+    set_primitive_cache_capacity(1);
+
+    uint64_t hits = 0, misses = 0, evictions = 0;
+    for (const auto &s : get_primitive_cache_stats()) {
+        if (s.kind != "eltwise") continue;
+        ASSERT_FALSE(s.impl.empty());
+        ASSERT_GE(s.creation_time_ms, 0.);
+        hits += s.hits;
+        misses += s.misses;
+        evictions += s.evictions;
+    }
+    ASSERT_EQ(hits, 3u);
+    ASSERT_EQ(misses, 3u);
+    ASSERT_EQ(evictions, 2u);
+
+    reset_primitive_cache_stats();
+    for (const auto &s : get_primitive_cache_stats()) {
+        ASSERT_EQ(s.hits, 0u);
+        ASSERT_EQ(s.misses, 0u);
+        ASSERT_EQ(s.evictions, 0u);
+    }
+
+    // The kernel cache has separate statistics.
+    reset_kernel_cache_stats();
+    for (const auto &s : get_kernel_cache_stats()) {
+        ASSERT_EQ(s.hits, 0u);
+        ASSERT_EQ(s.misses, 0u);
+        ASSERT_EQ(s.evictions, 0u);
+    }
+}
+
+TEST(primitive_cache_test, TestStatsFromManyThreads) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    reset_primitive_cache_stats();
+
+    // The hits of the same entries from different threads are all counted.
+    const int nthreads = 8, nrepeats = 16;
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; t++)
+        threads.emplace_back([&]() {
+            for (int r = 0; r < nrepeats; r++)
+                fill_primitive_cache(4, eng);
+        });
+    for (auto &t : threads)
+        t.join();
+
+    uint64_t hits = 0, misses = 0;
+    for (const auto &s : get_primitive_cache_stats()) {
+        if (s.kind != "eltwise") continue;
+        hits += s.hits;
+        misses += s.misses;
+    }
+    ASSERT_EQ(misses, 4u);
+    ASSERT_EQ(hits + misses, (uint64_t)nthreads * nrepeats * 4);
+}
+
+void test_create_async(int capacity) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(capacity);
+
+    engine eng(get_test_engine_kind(), 0);
+    const int n_unique = 4;
+    std::vector<primitive_desc_base> pds;
+    // Every primitive descriptor is requested twice, the duplicates must not
+    // be created again.
+    for (int r = 0; r < 2; r++) {
+        for (int i = 0; i < n_unique; i++) {
+            auto md = memory::desc({i + 1, 1, 1, 1}, dt::f32, tag::nchw);
+            pds.push_back(eltwise_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, algorithm::eltwise_relu, md,
+                    md, 0.f, 0.f));
+        }
+    }
+
+    auto futures = create_primitives_async(pds);
+    ASSERT_EQ(futures.size(), pds.size());
+    // Primitive descriptors are not needed after the call.
+    pds.clear();
+
+    for (const auto &f : futures) {
+        auto p = f.get_primitive();
+        ASSERT_TRUE(f.is_ready());
+        ASSERT_EQ(p.get_kind(), primitive::kind::eltwise);
+    }
+    ASSERT_EQ(get_primitive_cache_size(), std::min(n_unique, capacity));
+
+    ASSERT_TRUE(create_primitives_async({}).empty());
+}
+
+TEST(primitive_cache_test, TestCreateAsync) {
+    test_create_async(16);
+}
+
+// Without the primitive cache, the creations are deduplicated only while they
+// are in flight.
+TEST(primitive_cache_test, TestCreateAsyncNoCache) {
+    test_create_async(0);
+    set_primitive_cache_capacity(16);
+}
+
+TEST(primitive_cache_test, TestMaxThreads) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    custom_unsetenv("ONEDNN_PRIMITIVE_MAX_THREADS");
+    custom_unsetenv("DNNL_PRIMITIVE_MAX_THREADS");
+    ASSERT_EQ(get_primitive_max_threads(), 0);
+    EXPECT_ANY_THROW(set_primitive_max_threads(-1));
+
+    engine eng(get_test_engine_kind(), 0);
+    stream strm(eng);
+    const memory::dim M = 64, K = 96, N = 48;
+    auto src_md = memory::desc({M, K}, dt::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, dt::f32, tag::ab);
+    auto dst_md = memory::desc({M, N}, dt::f32, tag::ab);
+
+    memory src(src_md, eng), wei(wei_md, eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+
+    auto run_matmul = [&]() {
+        memory dst(dst_md, eng);
+        auto mm_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        matmul(mm_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+        return dst;
+    };
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    auto ref_dst = run_matmul();
+
+    // Thread-count adaptive primitives are created for more threads than
+    // available and must produce the same result.
+    set_primitive_max_threads(3);
+    ASSERT_EQ(get_primitive_max_threads(), 3);
+    auto dst = run_matmul();
+    auto dst2 = run_matmul();
+    compare_data<float>(ref_dst, dst);
+    compare_data<float>(ref_dst, dst2);
+
+    // Primitives are blocked for the limit set at creation, so a different
+    // limit must not reuse them.
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+    set_primitive_max_threads(8);
+    auto dst3 = run_matmul();
+    ASSERT_EQ(get_primitive_cache_size(), 3);
+    set_primitive_max_threads(0);
+
+    compare_data<float>(ref_dst, dst3);
+}
 #endif
 
 } // namespace dnnl
@@ -74,4 +74,112 @@ TEST_F(threadpool_test_t, TestMaxConcurrencyConcurrent) {
         ASSERT_EQ(r, dnnl_success);
 }
 
+TEST_F(threadpool_test_t, TestStreamCreateInvalidFlags) {
+    dnnl_engine_t engine;
+    DNNL_CHECK(dnnl_engine_create(&engine, dnnl_cpu, 0));
+
+    dnnl_stream_t stream = nullptr;
+    const unsigned both_orders
+            = dnnl_stream_in_order | dnnl_stream_out_of_order;
+    ASSERT_EQ(dnnl_threadpool_interop_stream_create_v2(&stream, engine,
+                      testing::get_threadpool(), both_orders),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_threadpool_interop_stream_create_v2(&stream, engine,
+                      testing::get_threadpool(), dnnl_stream_numa_aware),
+            dnnl_invalid_arguments);
+
+    DNNL_CHECK(dnnl_engine_destroy(engine));
+}
+
+TEST_F(threadpool_test_t, TestOutOfOrderStream) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm = threadpool_interop::make_stream(
+            eng, testing::get_threadpool(), stream::flags::out_of_order);
+
+    memory::desc md({16, 1024}, memory::data_type::f32, memory::format_tag::ab);
+    memory a(md, eng), b(md, eng), c(md, eng), d(md, eng);
+    const size_t nelems = md.get_size() / sizeof(float);
+    float *a_ptr = static_cast<float *>(a.get_data_handle());
+    for (size_t i = 0; i < nelems; i++)
+        a_ptr[i] = static_cast<float>(i % 17);
+
+    auto linear = [&](float alpha, float beta) {
+        return eltwise_forward(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_linear, md,
+                md, alpha, beta));
+    };
+    auto scale_2 = linear(2.f, 0.f);
+    auto shift_3 = linear(1.f, 3.f);
+    auto scale_half = linear(0.5f, 0.f);
+    auto scale_10 = linear(10.f, 0.f);
+    auto add = binary(
+            binary::primitive_desc(eng, algorithm::binary_add, md, md, md));
+
+    // b and c are independent branches joined by d. d is then updated in
+    // place, and a is overwritten only after both branches read it.
+    scale_2.execute(strm, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+    shift_3.execute(strm, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, c}});
+    add.execute(strm,
+            {{DNNL_ARG_SRC_0, b}, {DNNL_ARG_SRC_1, c}, {DNNL_ARG_DST, d}});
+    scale_half.execute(strm, {{DNNL_ARG_SRC, d}, {DNNL_ARG_DST, d}});
+    scale_10.execute(strm, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, a}});
+    strm.wait();
+
+    const float *d_ptr = static_cast<const float *>(d.get_data_handle());
+    for (size_t i = 0; i < nelems; i++) {
+        const float a0 = static_cast<float>(i % 17);
+        ASSERT_EQ(d_ptr[i], 0.5f * (2.f * a0 + a0 + 3.f));
+        ASSERT_EQ(a_ptr[i], 10.f * a0);
+    }
+}
+
+// The global scratchpad is reallocated when a primitive with a larger
+// scratchpad is created. A pending execution must not use the storage that is
+// freed then.
+TEST_F(threadpool_test_t, TestOutOfOrderStreamScratchpadGrowth) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm = threadpool_interop::make_stream(
+            eng, testing::get_threadpool(), stream::flags::out_of_order);
+
+    // A transposed source is copied to the scratchpad by most matmul
+    // implementations.
+    auto make_pd = [&](memory::dim M, memory::dim K, memory::dim N) {
+        return matmul::primitive_desc(eng,
+                memory::desc({M, K}, dt::f32, tag::ba),
+                memory::desc({K, N}, dt::f32, tag::ab),
+                memory::desc({M, N}, dt::f32, tag::ab));
+    };
+    const memory::dim M = 64, K = 128, N = 64;
+    auto small_pd = make_pd(M, K, N);
+    SKIP_IF(small_pd.scratchpad_desc().get_size() == 0,
+            "The matmul implementation does not use a scratchpad.");
+
+    memory src(small_pd.src_desc(), eng), wei(small_pd.weights_desc(), eng),
+            dst(small_pd.dst_desc(), eng);
+    for (auto *m : {&src, &wei}) {
+        float *ptr = static_cast<float *>(m->get_data_handle());
+        for (size_t i = 0; i < m->get_desc().get_size() / sizeof(float); i++)
+            ptr[i] = 1.f;
+    }
+
+    matmul(small_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+
+    // Grow the global scratchpad while the execution is pending.
+    auto big_pd = make_pd(16 * M, 16 * K, N);
+    SKIP_IF(big_pd.scratchpad_desc().get_size()
+                    <= small_pd.scratchpad_desc().get_size(),
+            "The scratchpad does not grow.");
+    matmul big(big_pd);
+    strm.wait();
+
+    const float *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_EQ(dst_ptr[i], static_cast<float>(K));
+}
+
 } // namespace dnnl
@@ -24,10 +24,39 @@
 #include "oneapi/dnnl/dnnl_ocl.hpp"
 #endif
 
+#ifndef _WIN32
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace dnnl {
 
 class persistent_cache_api_test_t : public ::testing::Test {};
 
+namespace {
+bool is_cache_blob_supported() {
+    if (get_test_engine_kind() == engine::kind::cpu)
+        return DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL;
+    return DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+            || DNNL_GPU_RUNTIME == DNNL_RUNTIME_ZE;
+}
+
+// CPU implementations opt in to cache blob support.
+bool has_cache_blob(const primitive &p) {
+    try {
+        return !p.get_cache_blob().empty();
+    } catch (error &e) {
+        if (get_test_engine_kind() == engine::kind::cpu
+                && e.status == dnnl_unimplemented)
+            return false;
+        throw;
+    }
+}
+} // namespace
+
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPI) {
     engine e = get_test_engine();
@@ -45,16 +74,14 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && (DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL
-                            && DNNL_GPU_RUNTIME != DNNL_RUNTIME_ZE))) {
+    if (!is_cache_blob_supported()) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
         EXPECT_ANY_THROW(convolution_forward(pd, cache_blob));
     } else {
         ASSERT_EQ(cache_blob_id.empty(), false);
+        if (!has_cache_blob(p)) return;
         ASSERT_NO_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), false);
         ASSERT_NO_THROW(p = convolution_forward(pd, cache_blob));
@@ -62,6 +89,198 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIMatMul) {
+    engine e = get_test_engine();
+    stream s(e);
+    const memory::dim M = 37, K = 70, N = 45;
+    auto src_md = memory::desc(
+            {M, K}, memory::data_type::f32, memory::format_tag::ab);
+    auto wei_md = memory::desc(
+            {K, N}, memory::data_type::f32, memory::format_tag::ab);
+    auto dst_md = memory::desc(
+            {M, N}, memory::data_type::f32, memory::format_tag::ab);
+    auto pd = matmul::primitive_desc(e, src_md, wei_md, dst_md);
+    auto p = matmul(pd);
+    if (!is_cache_blob_supported() || !has_cache_blob(p)) return;
+
+    std::vector<uint8_t> cache_blob = p.get_cache_blob();
+    matmul p_from_blob;
+    ASSERT_NO_THROW(p_from_blob = matmul(pd, cache_blob));
+    ASSERT_EQ(cache_blob, p_from_blob.get_cache_blob());
+
+    // The primitive created from the cache blob computes the same result.
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto dst_from_blob = test::make_memory(dst_md, e);
+    fill_data<float>(src_md.get_size() / sizeof(float), src, 1.f, 0.5f);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei, 1.f, 0.5f);
+
+    p.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    p_from_blob.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_from_blob}});
+    s.wait();
+    compare_data<float>(dst, dst_from_blob);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIConvolution) {
+    engine e = get_test_engine();
+    stream s(e);
+    // Blocked layouts let brgemm-based implementations be picked.
+    auto pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            {{2, 64, 15, 15}, memory::data_type::f32, memory::format_tag::any},
+            {{64, 64, 3, 3}, memory::data_type::f32, memory::format_tag::any},
+            {{2, 64, 15, 15}, memory::data_type::f32, memory::format_tag::any},
+            {1, 1}, {1, 1}, {1, 1}};
+    auto p = convolution_forward(pd);
+    if (!is_cache_blob_supported() || !has_cache_blob(p)) return;
+
+    std::vector<uint8_t> cache_blob = p.get_cache_blob();
+    convolution_forward p_from_blob;
+    ASSERT_NO_THROW(p_from_blob = convolution_forward(pd, cache_blob));
+    ASSERT_EQ(cache_blob, p_from_blob.get_cache_blob());
+
+    // The primitive created from the cache blob computes the same result.
+    auto src = test::make_memory(pd.src_desc(), e);
+    auto wei = test::make_memory(pd.weights_desc(), e);
+    auto dst = test::make_memory(pd.dst_desc(), e);
+    auto dst_from_blob = test::make_memory(pd.dst_desc(), e);
+    fill_data<float>(
+            pd.src_desc().get_size() / sizeof(float), src, 1.f, 0.5f);
+    fill_data<float>(
+            pd.weights_desc().get_size() / sizeof(float), wei, 1.f, 0.5f);
+
+    p.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    p_from_blob.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_from_blob}});
+    s.wait();
+    compare_data<float>(dst, dst_from_blob);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentPrimitiveCacheDir) {
+    engine e = get_test_engine();
+    auto pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_training, algorithm::convolution_direct,
+            {{2, 16, 16, 16}, memory::data_type::f32, memory::format_tag::nchw},
+            {{16, 16, 3, 3}, memory::data_type::f32, memory::format_tag::oihw},
+            {{2, 16, 14, 14}, memory::data_type::f32, memory::format_tag::nchw},
+            {1, 1}, {0, 0}, {0, 0}};
+
+    // Disable the primitive cache to make sure primitives are either created
+    // or loaded from the persistent cache.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    ASSERT_NO_THROW(set_primitive_cache_dir(::testing::TempDir()));
+
+    auto p0 = convolution_forward(pd);
+    auto p1 = convolution_forward(pd);
+    if (is_cache_blob_supported() && has_cache_blob(p0)) {
+        ASSERT_EQ(p0.get_cache_blob(), p1.get_cache_blob());
+    }
+
+    ASSERT_NO_THROW(set_primitive_cache_dir(""));
+    ASSERT_NO_THROW(p1 = convolution_forward(pd));
+    set_primitive_cache_capacity(capacity);
+}
+
+#ifndef _WIN32
+namespace {
+std::vector<std::string> list_files(const std::string &dir) {
+    std::vector<std::string> files;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return files;
+    while (struct dirent *e = readdir(d))
+        if (e->d_name[0] != '.') files.push_back(dir + "/" + e->d_name);
+    closedir(d);
+    return files;
+}
+
+std::vector<uint8_t> read_file(const std::string &path) {
+    std::vector<uint8_t> data;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return data;
+    int c;
+    while ((c = fgetc(f)) != EOF)
+        data.push_back(static_cast<uint8_t>(c));
+    fclose(f);
+    return data;
+}
+
+void write_file(const std::string &path, const std::vector<uint8_t> &data) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) return;
+    fwrite(data.data(), 1, data.size(), f);
+    fclose(f);
+}
+} // namespace
+
+// Entries that are corrupted or writable by other users are not loaded, so
+// the primitive is created from scratch and the entry is written again.
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentPrimitiveCacheUntrusted) {
+    engine e = get_test_engine();
+    const memory::dim M = 37, K = 70, N = 45;
+    auto pd = matmul::primitive_desc(e,
+            {{M, K}, memory::data_type::f32, memory::format_tag::ab},
+            {{K, N}, memory::data_type::f32, memory::format_tag::ab},
+            {{M, N}, memory::data_type::f32, memory::format_tag::ab});
+    if (!is_cache_blob_supported() || !has_cache_blob(matmul(pd))) return;
+
+    char dir[] = "/tmp/onednn_primitive_cache_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    ASSERT_NO_THROW(set_primitive_cache_dir(dir));
+
+    auto p = matmul(pd);
+    auto files = list_files(dir);
+    ASSERT_EQ(files.size(), 1U);
+    const std::string entry = files[0];
+    const auto content = read_file(entry);
+    ASSERT_FALSE(content.empty());
+    struct stat st;
+    ASSERT_EQ(stat(entry.c_str(), &st), 0);
+    ASSERT_EQ(st.st_mode & 0777, 0600U);
+
+    // A corrupted blob fails the digest check.
+    auto corrupted = content;
+    corrupted.back() ^= 0xff;
+    write_file(entry, corrupted);
+    ASSERT_NO_THROW(p = matmul(pd));
+    ASSERT_EQ(read_file(entry), content);
+
+    // An entry writable by others is not trusted even if it is intact.
+    ASSERT_EQ(chmod(entry.c_str(), 0666), 0);
+    ASSERT_NO_THROW(p = matmul(pd));
+    ASSERT_EQ(stat(entry.c_str(), &st), 0);
+    ASSERT_EQ(st.st_mode & 0777, 0600U);
+
+    // A symbolic link to a valid entry is not followed.
+    const std::string moved = std::string(dir) + "/moved";
+    ASSERT_EQ(rename(entry.c_str(), moved.c_str()), 0);
+    ASSERT_EQ(symlink(moved.c_str(), entry.c_str()), 0);
+    ASSERT_NO_THROW(p = matmul(pd));
+    ASSERT_EQ(lstat(entry.c_str(), &st), 0);
+    ASSERT_TRUE(S_ISREG(st.st_mode));
+
+    ASSERT_NO_THROW(set_primitive_cache_dir(""));
+    set_primitive_cache_capacity(capacity);
+    for (const auto &f : list_files(dir))
+        unlink(f.c_str());
+    rmdir(dir);
+}
+#endif
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {